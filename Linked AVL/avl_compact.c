@@ -0,0 +1,351 @@
+/**
+ * -------------------------------------
+ * @file  avl_compact.c
+ * Compact AVL Source Code File
+ * -------------------------------------
+ * @author Filip Stanojcic
+ *
+ * @version 2026-10-18
+ *
+ */
+// Includes
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "avl_compact.h"
+
+// Local Functions
+
+/**
+ * Takes a node slot from the free list or the end of the array, growing
+ * the array when it is full, and fills it with a copy of item.
+ *
+ * @param source - pointer to a compact AVL
+ * @param item - pointer to the item to assign to the node
+ * @return index of the new node, AVL_COMPACT_NIL if no slot is available
+ */
+static uint32_t avl_compact_node_initialize(avl_compact *source,
+		const data_ptr item) {
+	uint32_t node = source->free_list;
+
+	if (node != AVL_COMPACT_NIL) {
+		source->free_list = source->nodes[node].left;
+	} else {
+		if (source->used == source->capacity) {
+			if (source->capacity > UINT32_MAX / 2) {
+				return AVL_COMPACT_NIL;
+			}
+			source->capacity *= 2;
+			source->nodes = realloc(source->nodes,
+					source->capacity * sizeof *source->nodes);
+		}
+		node = source->used;
+		source->used++;
+	}
+	data_copy(&source->nodes[node].item, item);
+	source->nodes[node].height = 1;
+	source->nodes[node].left = AVL_COMPACT_NIL;
+	source->nodes[node].right = AVL_COMPACT_NIL;
+	return node;
+}
+
+/**
+ * Returns a node slot to the free list.
+ *
+ * @param source - pointer to a compact AVL
+ * @param node - index of the node to release
+ */
+static void avl_compact_node_free(avl_compact *source, uint32_t node) {
+	source->nodes[node].left = source->free_list;
+	source->free_list = node;
+	return;
+}
+
+/**
+ * Updates the height of a node. Its height is the max of the heights of its
+ * child nodes, plus 1. The sentinel gives empty children a height of 0.
+ * @param nodes - array of node slots
+ * @param node - index of the node to process
+ */
+static void avl_compact_update_height(avl_compact_node *nodes, uint32_t node) {
+	int8_t left_height = nodes[nodes[node].left].height;
+	int8_t right_height = nodes[nodes[node].right].height;
+
+	if (left_height >= right_height) {
+		nodes[node].height = left_height + 1;
+	} else {
+		nodes[node].height = right_height + 1;
+	}
+	return;
+}
+
+/**
+ * Returns the balance of a node.
+ * @param nodes - array of node slots
+ * @param node - index of the node to process
+ * @return height of left child less height of right child
+ */
+static int avl_compact_balance(const avl_compact_node *nodes, uint32_t node) {
+	return (nodes[nodes[node].left].height - nodes[nodes[node].right].height);
+}
+
+/**
+ * Performs a left rotation around node.
+ * @param nodes - array of node slots
+ * @param node - index of the node to process
+ * @return index of new root of subtree
+ */
+static uint32_t avl_compact_rotate_left(avl_compact_node *nodes, uint32_t node) {
+	uint32_t newRoot = nodes[node].right;
+	nodes[node].right = nodes[newRoot].left;
+	nodes[newRoot].left = node;
+
+	// Update heights
+	avl_compact_update_height(nodes, node);
+	avl_compact_update_height(nodes, newRoot);
+
+	return newRoot;
+}
+
+/**
+ * Performs a right rotation around node.
+ * @param nodes - array of node slots
+ * @param node - index of the node to process
+ * @return index of new root of subtree
+ */
+static uint32_t avl_compact_rotate_right(avl_compact_node *nodes, uint32_t node) {
+	uint32_t newRoot = nodes[node].left;
+	nodes[node].left = nodes[newRoot].right;
+	nodes[newRoot].right = node;
+
+	// Update heights
+	avl_compact_update_height(nodes, node);
+	avl_compact_update_height(nodes, newRoot);
+
+	return newRoot;
+}
+
+/**
+ * Rebalances a node according to AVL rules.
+ * @param nodes - array of node slots
+ * @param node - index of the node to process
+ * @return index of new root of subtree
+ */
+static uint32_t avl_compact_rebalance(avl_compact_node *nodes, uint32_t node) {
+	avl_compact_update_height(nodes, node);
+	int balance = avl_compact_balance(nodes, node);
+
+	// Left Heavy
+	if (balance > 1) {
+		if (avl_compact_balance(nodes, nodes[node].left) < 0) {
+			nodes[node].left = avl_compact_rotate_left(nodes, nodes[node].left);
+		}
+		node = avl_compact_rotate_right(nodes, node);
+	}
+	// Right Heavy
+	else if (balance < -1) {
+		if (avl_compact_balance(nodes, nodes[node].right) > 0) {
+			nodes[node].right = avl_compact_rotate_right(nodes,
+					nodes[node].right);
+		}
+		node = avl_compact_rotate_left(nodes, node);
+	}
+	return node;
+}
+
+/**
+ * Inserts item below node. Only one of item may be in the AVL. The node
+ * array may move, so children are reached by index only.
+ * @param source - pointer to a compact AVL
+ * @param node - index of the node to process
+ * @param item - the item to insert
+ * @param inserted - set to TRUE if the item is inserted
+ * @return index of new root of subtree
+ */
+static uint32_t avl_compact_insert_aux(avl_compact *source, uint32_t node,
+		const data_ptr item, BOOLEAN *inserted) {
+
+	if (node == AVL_COMPACT_NIL) {
+		// Base case: add a new node containing a copy of item.
+		node = avl_compact_node_initialize(source, item);
+		*inserted = (node != AVL_COMPACT_NIL);
+	} else {
+		int comp = data_compare(item, &source->nodes[node].item);
+
+		if (comp < 0) {
+			uint32_t child = avl_compact_insert_aux(source,
+					source->nodes[node].left, item, inserted);
+			source->nodes[node].left = child;
+		} else if (comp > 0) {
+			uint32_t child = avl_compact_insert_aux(source,
+					source->nodes[node].right, item, inserted);
+			source->nodes[node].right = child;
+		}
+		if (*inserted) {
+			node = avl_compact_rebalance(source->nodes, node);
+		}
+	}
+	return node;
+}
+
+/**
+ * Removes the item matching key below node.
+ * @param source - pointer to a compact AVL
+ * @param node - index of the node to process
+ * @param key - the key to look for
+ * @param item - if not NULL, copy of the item removed
+ * @param removed - set to TRUE if the key is found and the item removed
+ * @return index of new root of subtree
+ */
+static uint32_t avl_compact_remove_aux(avl_compact *source, uint32_t node,
+		const data_ptr key, data_ptr item, BOOLEAN *removed) {
+	avl_compact_node *nodes = source->nodes;
+
+	if (node != AVL_COMPACT_NIL) {
+		int comp = data_compare(key, &nodes[node].item);
+
+		if (comp < 0) {
+			nodes[node].left = avl_compact_remove_aux(source, nodes[node].left,
+					key, item, removed);
+		} else if (comp > 0) {
+			nodes[node].right = avl_compact_remove_aux(source,
+					nodes[node].right, key, item, removed);
+		} else {
+			*removed = TRUE;
+
+			if (item != NULL) {
+				data_copy(item, &nodes[node].item);
+			}
+			if (nodes[node].left == AVL_COMPACT_NIL
+					|| nodes[node].right == AVL_COMPACT_NIL) {
+				// Replace the node by its only child.
+				uint32_t child = nodes[node].left != AVL_COMPACT_NIL ?
+						nodes[node].left : nodes[node].right;
+				avl_compact_node_free(source, node);
+				node = child;
+			} else {
+				// Replace the item with its successor and remove the successor.
+				uint32_t successor = nodes[node].right;
+
+				while (nodes[successor].left != AVL_COMPACT_NIL) {
+					successor = nodes[successor].left;
+				}
+				data_copy(&nodes[node].item, &nodes[successor].item);
+				nodes[node].right = avl_compact_remove_aux(source,
+						nodes[node].right, &nodes[node].item, NULL, removed);
+			}
+		}
+		if (*removed && node != AVL_COMPACT_NIL) {
+			node = avl_compact_rebalance(nodes, node);
+		}
+	}
+	return node;
+}
+
+/**
+ * Copies the contents of a node to an array location.
+ *
+ * @param source - pointer to a compact AVL
+ * @param items - array of items
+ * @param node - index of a node
+ * @param index - current index in array
+ * @return - the updated index
+ */
+static int avl_compact_inorder_aux(const avl_compact *source, data_ptr *items,
+		uint32_t node, int index) {
+
+	if (node != AVL_COMPACT_NIL) {
+		index = avl_compact_inorder_aux(source, items, source->nodes[node].left,
+				index);
+		items[index] = (data_ptr) &source->nodes[node].item;
+		index++;
+		index = avl_compact_inorder_aux(source, items,
+				source->nodes[node].right, index);
+	}
+	return index;
+}
+
+//--------------------------------------------------------------------
+// Functions
+
+avl_compact* avl_compact_initialize() {
+	avl_compact *source = malloc(sizeof *source);
+	source->count = 0;
+	source->root = AVL_COMPACT_NIL;
+	source->capacity = AVL_COMPACT_INIT;
+	source->nodes = malloc(source->capacity * sizeof *source->nodes);
+	// Slot 0 is the empty subtree.
+	source->nodes[AVL_COMPACT_NIL].height = 0;
+	source->nodes[AVL_COMPACT_NIL].left = AVL_COMPACT_NIL;
+	source->nodes[AVL_COMPACT_NIL].right = AVL_COMPACT_NIL;
+	source->used = 1;
+	source->free_list = AVL_COMPACT_NIL;
+	return source;
+}
+
+void avl_compact_free(avl_compact **source) {
+	free((*source)->nodes);
+	free(*source);
+	*source = NULL;
+	return;
+}
+
+BOOLEAN avl_compact_empty(const avl_compact *source) {
+	return (source->root == AVL_COMPACT_NIL);
+}
+
+int avl_compact_count(const avl_compact *source) {
+	return source->count;
+}
+
+BOOLEAN avl_compact_insert(avl_compact *source, const data_ptr item) {
+	BOOLEAN inserted = FALSE;
+
+	source->root = avl_compact_insert_aux(source, source->root, item,
+			&inserted);
+
+	if (inserted) {
+		source->count++;
+	}
+	return inserted;
+}
+
+BOOLEAN avl_compact_retrieve(const avl_compact *source, const data_ptr key,
+		data_ptr item) {
+	BOOLEAN retrieved = FALSE;
+	const avl_compact_node *nodes = source->nodes;
+	uint32_t node = source->root;
+
+	while ((node != AVL_COMPACT_NIL) && (retrieved == FALSE)) {
+		int comp = data_compare(key, (data_ptr) &nodes[node].item);
+
+		if (comp < 0) {
+			node = nodes[node].left;
+		} else if (comp > 0) {
+			node = nodes[node].right;
+		} else {
+			data_copy(item, (data_ptr) &nodes[node].item);
+			retrieved = TRUE;
+		}
+	}
+	return retrieved;
+}
+
+BOOLEAN avl_compact_remove(avl_compact *source, const data_ptr key,
+		data_ptr item) {
+	BOOLEAN removed = FALSE;
+
+	source->root = avl_compact_remove_aux(source, source->root, key, item,
+			&removed);
+
+	if (removed) {
+		source->count--;
+	}
+	return removed;
+}
+
+// Copies the contents of a compact AVL to an array in inorder.
+void avl_compact_inorder(const avl_compact *source, data_ptr *items) {
+	avl_compact_inorder_aux(source, items, source->root, 0);
+	return;
+}
@@ -0,0 +1,124 @@
+/**
+ * -------------------------------------
+ * @file  avl_compact.h
+ * Compact AVL Header File
+ * -------------------------------------
+ * @author Filip Stanojcic
+ *
+ * @version 2026-10-18
+ *
+ * An AVL whose nodes live in one growable array. Children are 32-bit
+ * array indexes, heights are 8 bits and items are stored inside the node,
+ * so a node with an int item takes 16 bytes and needs no separate item
+ * allocation. Slot 0 is an empty sentinel with height 0. Removed slots are
+ * recycled through a free list linked by their left index.
+ */
+#ifndef AVL_COMPACT_H_
+#define AVL_COMPACT_H_
+
+// Includes
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "data.h"
+
+#define AVL_COMPACT_NIL 0   // Index of the empty subtree
+#define AVL_COMPACT_INIT 16 // Initial number of node slots
+
+// typedefs
+/**
+ * Compact AVL node
+ */
+typedef struct {
+    data_value item;         // The node data.
+    uint32_t left;           // Index of the left child.
+    uint32_t right;          // Index of the right child.
+    int8_t height;           // Height of the current node.
+} avl_compact_node;
+
+/**
+ * Compact AVL header
+ */
+typedef struct {
+    int count;               // Number of nodes in the AVL.
+    uint32_t root;           // Index of root node of the AVL.
+    uint32_t capacity;       // Number of slots in nodes.
+    uint32_t used;           // Number of slots ever handed out, including slot 0.
+    uint32_t free_list;      // Index of the first recycled slot.
+    avl_compact_node *nodes; // Array of node slots.
+} avl_compact;
+
+// Prototypes
+
+/**
+ * Initializes a compact AVL.
+ *
+ * @return pointer to a compact AVL
+ */
+avl_compact* avl_compact_initialize();
+
+/**
+ * Frees all parts of a compact AVL.
+ *
+ * @param source - pointer to a compact AVL
+ */
+void avl_compact_free(avl_compact **source);
+
+/**
+ * Determines if a compact AVL is empty.
+ *
+ * @param source - pointer to a compact AVL
+ * @return TRUE if the AVL is empty, FALSE otherwise
+ */
+BOOLEAN avl_compact_empty(const avl_compact *source);
+
+/**
+ * Returns number of items in a compact AVL.
+ *
+ * @param source - pointer to a compact AVL
+ * @return - number of items in AVL
+ */
+int avl_compact_count(const avl_compact *source);
+
+/**
+ * Inserts a copy of an item into a compact AVL.
+ *
+ * @param source - pointer to a compact AVL
+ * @param item - pointer to the item to insert
+ * @return - TRUE if item inserted, FALSE otherwise
+ */
+BOOLEAN avl_compact_insert(avl_compact *source, const data_ptr item);
+
+/**
+ * Retrieves a copy of a value matching key in a compact AVL.
+ *
+ * @param source - pointer to a compact AVL
+ * @param key - key value to search for
+ * @param item - pointer to copy of the item retrieved
+ * @return - TRUE if item retrieved, FALSE otherwise (key not found)
+ */
+BOOLEAN avl_compact_retrieve(const avl_compact *source, const data_ptr key,
+        data_ptr item);
+
+/**
+ * Removes a value matching key in a compact AVL.
+ *
+ * @param source - pointer to a compact AVL
+ * @param key - key value to search for
+ * @param item - pointer to copy of the item removed
+ * @return - TRUE if item removed, FALSE otherwise (key not found)
+ */
+BOOLEAN avl_compact_remove(avl_compact *source, const data_ptr key,
+        data_ptr item);
+
+/**
+ * Copies the contents of a compact AVL to an array in inorder. The item
+ * pointers are valid until the next insert.
+ *
+ * @param source - pointer to a compact AVL
+ * @param items - array of items: length must be at least size of AVL
+ */
+void avl_compact_inorder(const avl_compact *source, data_ptr *items);
+
+#endif /* AVL_COMPACT_H_ */
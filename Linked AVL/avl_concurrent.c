@@ -0,0 +1,766 @@
+/**
+ * -------------------------------------
+ * @file  avl_concurrent.c
+ * Concurrent AVL Source Code File
+ * -------------------------------------
+ * @author Filip Stanojcic
+ *
+ * @version 2026-10-18
+ *
+ */
+// Includes
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "avl_concurrent.h"
+
+// Node version bits: a changing node is being rotated down, an unlinked
+// node has left the tree. Every completed change adds AVL_CNODE_STEP.
+#define AVL_CNODE_CHANGING 1UL
+#define AVL_CNODE_UNLINKED 2UL
+#define AVL_CNODE_BUSY (AVL_CNODE_CHANGING | AVL_CNODE_UNLINKED)
+#define AVL_CNODE_STEP 4UL
+#define AVL_ACQUIRE(p) atomic_load_explicit((p), memory_order_acquire)
+
+/**
+ * Reader epoch slot - one per running thread, padded to its own cache line.
+ * A thread takes a free slot on its first retrieve and gives it back when
+ * it exits.
+ */
+typedef struct {
+	_Alignas(64) atomic_ulong epoch; // 0 if the thread is not reading.
+	atomic_int used;                 // 1 while a thread owns the slot.
+} avl_epoch_slot;
+
+static atomic_ulong avl_epoch = 1;
+static atomic_int avl_epoch_threads = 0; // Slots ever used - reclaim scans these.
+static avl_epoch_slot avl_epoch_slots[AVL_CONCURRENT_MAX_THREADS];
+static _Thread_local int avl_epoch_index = -1;
+static pthread_once_t avl_epoch_once = PTHREAD_ONCE_INIT;
+static pthread_key_t avl_epoch_key; // Gives a slot back when its thread exits.
+
+/**
+ * The nodes a writer has locked on its search path. slots[d] is the link
+ * to nodes[d], so slots[0] is the root link. nodes[top] to nodes[depth - 1]
+ * are locked, and so is the lock that guards slots[top]: the root lock if
+ * top is 0, or else the lock of nodes[top - 1].
+ */
+typedef struct {
+	_Atomic(avl_cnode*) *slots[AVL_CONCURRENT_DEPTH]; // Link to each node.
+	avl_cnode *nodes[AVL_CONCURRENT_DEPTH];           // Nodes on the path.
+	int top;                                          // First locked node.
+	int depth;                                        // Number of nodes on the path.
+} avl_cpath;
+
+// Local Functions
+
+/**
+ * Frees an exiting thread's epoch slot for another thread.
+ *
+ * @param slot - the exiting thread's epoch slot
+ */
+static void avl_epoch_release(void *slot) {
+	atomic_store(&((avl_epoch_slot*) slot)->used, 0);
+	return;
+}
+
+/**
+ * Creates the key whose destructor frees a thread's epoch slot.
+ */
+static void avl_epoch_key_create(void) {
+	pthread_key_create(&avl_epoch_key, avl_epoch_release);
+	return;
+}
+
+/**
+ * Marks the calling thread as reading. Nodes unlinked from now on are not
+ * freed until the thread calls avl_epoch_exit.
+ *
+ * @return - the calling thread's epoch slot
+ */
+static avl_epoch_slot* avl_epoch_enter(void) {
+
+	if (avl_epoch_index < 0) {
+		int index = 0;
+		int unused = 0;
+
+		pthread_once(&avl_epoch_once, avl_epoch_key_create);
+
+		while (index < AVL_CONCURRENT_MAX_THREADS
+				&& !atomic_compare_exchange_strong(
+						&avl_epoch_slots[index].used, &unused, 1)) {
+			unused = 0;
+			index++;
+		}
+		if (index >= AVL_CONCURRENT_MAX_THREADS) {
+			fprintf(stderr, "avl_concurrent: more than %d threads at once\n",
+			AVL_CONCURRENT_MAX_THREADS);
+			abort();
+		}
+		int threads = atomic_load(&avl_epoch_threads);
+
+		while (threads <= index
+				&& !atomic_compare_exchange_weak(&avl_epoch_threads, &threads,
+						index + 1)) {
+			// threads now holds the current count: try again if still lower.
+		}
+		avl_epoch_index = index;
+		pthread_setspecific(avl_epoch_key, &avl_epoch_slots[index]);
+	}
+	avl_epoch_slot *slot = &avl_epoch_slots[avl_epoch_index];
+	atomic_store(&slot->epoch, atomic_load(&avl_epoch));
+	return slot;
+}
+
+/**
+ * Marks the calling thread as no longer reading.
+ *
+ * @param slot - the calling thread's epoch slot
+ */
+static void avl_epoch_exit(avl_epoch_slot *slot) {
+	atomic_store_explicit(&slot->epoch, 0, memory_order_release);
+	return;
+}
+
+/**
+ * Initializes a new node with a copy of item.
+ *
+ * @param item - pointer to the item to assign to the node
+ * @return a pointer to a new node
+ */
+static avl_cnode* avl_cnode_initialize(const data_ptr item) {
+	// aligned_alloc needs a size that is a multiple of the alignment.
+	size_t size = (sizeof(avl_cnode) + AVL_CONCURRENT_ALIGN - 1)
+			/ AVL_CONCURRENT_ALIGN * AVL_CONCURRENT_ALIGN;
+	avl_cnode *node = aligned_alloc(AVL_CONCURRENT_ALIGN, size);
+	data_copy(&node->item, item);
+	atomic_init(&node->present, TRUE);
+	atomic_init(&node->version, 0);
+	node->height = 1;
+	atomic_init(&node->left, NULL);
+	atomic_init(&node->right, NULL);
+	node->retired = NULL;
+	node->epoch = 0;
+	pthread_mutex_init(&node->lock, NULL);
+	return node;
+}
+
+/**
+ * Frees a node.
+ * @param node - The node to process
+ */
+static void avl_cnode_free(avl_cnode *node) {
+	pthread_mutex_destroy(&node->lock);
+	free(node);
+	return;
+}
+
+/**
+ * Frees a node and its children.
+ * @param node - The node to process
+ */
+static void avl_cnode_free_aux(avl_cnode *node) {
+
+	if (node != NULL) {
+		avl_cnode_free_aux(atomic_load(&node->left));
+		avl_cnode_free_aux(atomic_load(&node->right));
+		avl_cnode_free(node);
+	}
+	return;
+}
+
+/**
+ * Frees every retired node that no running reader can still reach.
+ *
+ * @param source - pointer to a concurrent AVL
+ */
+static void avl_concurrent_reclaim(avl_concurrent *source) {
+	// Readers that start after this see an epoch newer than every retired node.
+	unsigned long oldest = atomic_fetch_add(&avl_epoch, 1) + 1;
+	int threads = atomic_load(&avl_epoch_threads);
+
+	if (threads > AVL_CONCURRENT_MAX_THREADS) {
+		threads = AVL_CONCURRENT_MAX_THREADS;
+	}
+	for (int i = 0; i < threads; i++) {
+		unsigned long epoch = atomic_load(&avl_epoch_slots[i].epoch);
+
+		if (epoch != 0 && epoch < oldest) {
+			oldest = epoch;
+		}
+	}
+	avl_cnode **link = &source->retired;
+
+	while (*link != NULL) {
+		avl_cnode *node = *link;
+
+		if (node->epoch < oldest) {
+			*link = node->retired;
+			avl_cnode_free(node);
+			source->retired_count--;
+		} else {
+			link = &node->retired;
+		}
+	}
+	return;
+}
+
+/**
+ * Helper function to determine the height of node - handles empty node.
+ * @param node - The node to process.
+ * @return The height of the current node.
+ */
+static int avl_cnode_height(const avl_cnode *node) {
+	int height = 0;
+
+	if (node != NULL) {
+		height = node->height;
+	}
+	return (height);
+}
+
+/**
+ * Updates the height of a node. Its height is the max of the heights of its
+ * child nodes, plus 1.
+ * @param node - The node to process.
+ */
+static void avl_cnode_update_height(avl_cnode *node) {
+	int left_height = avl_cnode_height(atomic_load(&node->left));
+	int right_height = avl_cnode_height(atomic_load(&node->right));
+
+	if (left_height >= right_height) {
+		node->height = left_height + 1;
+	} else {
+		node->height = right_height + 1;
+	}
+	return;
+}
+
+/**
+ * Returns the balance of a node.
+ * @param node - The node to process.
+ * @return height of left child less height of right child
+ */
+static int avl_cnode_balance(const avl_cnode *node) {
+	return (avl_cnode_height(atomic_load(&node->left))
+			- avl_cnode_height(atomic_load(&node->right)));
+}
+
+/**
+ * Performs a left rotation around the node in slot. The node moves down
+ * and is marked as changing until the rotation is complete.
+ * @param slot - link to the node to process
+ */
+static void avl_cnode_rotate_left(_Atomic(avl_cnode*) *slot) {
+	avl_cnode *node = atomic_load(slot);
+	avl_cnode *newRoot = atomic_load(&node->right);
+	unsigned long version = atomic_load(&node->version);
+
+	atomic_store(&node->version, version | AVL_CNODE_CHANGING);
+	atomic_store(&node->right, atomic_load(&newRoot->left));
+	atomic_store(&newRoot->left, node);
+	atomic_store(slot, newRoot);
+
+	// Update heights
+	avl_cnode_update_height(node);
+	avl_cnode_update_height(newRoot);
+	atomic_store(&node->version, version + AVL_CNODE_STEP);
+	return;
+}
+
+/**
+ * Performs a right rotation around the node in slot. The node moves down
+ * and is marked as changing until the rotation is complete.
+ * @param slot - link to the node to process
+ */
+static void avl_cnode_rotate_right(_Atomic(avl_cnode*) *slot) {
+	avl_cnode *node = atomic_load(slot);
+	avl_cnode *newRoot = atomic_load(&node->left);
+	unsigned long version = atomic_load(&node->version);
+
+	atomic_store(&node->version, version | AVL_CNODE_CHANGING);
+	atomic_store(&node->left, atomic_load(&newRoot->right));
+	atomic_store(&newRoot->right, node);
+	atomic_store(slot, newRoot);
+
+	// Update heights
+	avl_cnode_update_height(node);
+	avl_cnode_update_height(newRoot);
+	atomic_store(&node->version, version + AVL_CNODE_STEP);
+	return;
+}
+
+/**
+ * Rebalances the node in slot according to AVL rules.
+ * @param slot - link to the node to process
+ */
+static void avl_cnode_rebalance(_Atomic(avl_cnode*) *slot) {
+	avl_cnode *node = atomic_load(slot);
+	avl_cnode_update_height(node);
+	int balance = avl_cnode_balance(node);
+
+	// Left Heavy
+	if (balance > 1) {
+		if (avl_cnode_balance(atomic_load(&node->left)) < 0) {
+			avl_cnode_rotate_left(&node->left);
+		}
+		avl_cnode_rotate_right(slot);
+	}
+	// Right Heavy
+	else if (balance < -1) {
+		if (avl_cnode_balance(atomic_load(&node->right)) > 0) {
+			avl_cnode_rotate_right(&node->right);
+		}
+		avl_cnode_rotate_left(slot);
+	}
+	return;
+}
+
+/**
+ * Determines whether a node is a routing node that can be unlinked: it
+ * was removed and has at most one child. The node must be locked.
+ * @param node - The node to process.
+ * @return TRUE if the node can be unlinked, FALSE otherwise
+ */
+static BOOLEAN avl_cnode_routing(avl_cnode *node) {
+	return (!atomic_load(&node->present)
+			&& (atomic_load(&node->left) == NULL
+					|| atomic_load(&node->right) == NULL));
+}
+
+/**
+ * Rebalances the node in slot after a remove below it. The remove made
+ * the path side shorter, so a rotation lifts the other child, and for a
+ * double rotation that child's inner child: neither is on the writer's
+ * path, so both are locked while they move. A rotation can leave the
+ * lifted child with one child fewer: if that makes it a routing node that
+ * can be unlinked, its item is copied to routing.
+ * @param slot - link to the node to process
+ * @param routing - set to the item of a routing node to unlink
+ * @return TRUE if routing was set, FALSE otherwise
+ */
+static BOOLEAN avl_cnode_rebalance_remove(_Atomic(avl_cnode*) *slot,
+		data_ptr routing) {
+	BOOLEAN found = FALSE;
+	avl_cnode *node = atomic_load(slot);
+	avl_cnode_update_height(node);
+	int balance = avl_cnode_balance(node);
+
+	if (balance > 1 || balance < -1) {
+		avl_cnode *child = atomic_load(balance > 1 ? &node->left : &node->right);
+		avl_cnode *inner = NULL;
+
+		pthread_mutex_lock(&child->lock);
+
+		if (balance > 1 && avl_cnode_balance(child) < 0) {
+			inner = atomic_load(&child->right);
+		} else if (balance < -1 && avl_cnode_balance(child) > 0) {
+			inner = atomic_load(&child->left);
+		}
+		if (inner != NULL) {
+			pthread_mutex_lock(&inner->lock);
+		}
+		avl_cnode_rebalance(slot);
+
+		if (avl_cnode_routing(child)) {
+			data_copy(routing, &child->item);
+			found = TRUE;
+		}
+		if (inner != NULL) {
+			pthread_mutex_unlock(&inner->lock);
+		}
+		pthread_mutex_unlock(&child->lock);
+	}
+	return found;
+}
+
+/**
+ * Replaces the node in slot by its only child. The node stays locked and
+ * must be retired once it is unlocked.
+ * @param slot - link to the node to process
+ */
+static void avl_cnode_unlink(_Atomic(avl_cnode*) *slot) {
+	avl_cnode *node = atomic_load(slot);
+	avl_cnode *child = atomic_load(&node->left);
+
+	if (child == NULL) {
+		child = atomic_load(&node->right);
+	}
+	atomic_store(&node->version,
+			(atomic_load(&node->version) + AVL_CNODE_STEP) | AVL_CNODE_UNLINKED);
+	atomic_store(slot, child);
+	node->epoch = atomic_load(&avl_epoch);
+	return;
+}
+
+/**
+ * Adds an unlinked node to the nodes waiting to be freed, and frees those
+ * no reader can reach once enough are waiting.
+ * @param source - pointer to a concurrent AVL
+ * @param node - the unlinked node, not locked by any writer
+ */
+static void avl_concurrent_retire(avl_concurrent *source, avl_cnode *node) {
+	pthread_mutex_lock(&source->retire_lock);
+	node->retired = source->retired;
+	source->retired = node;
+	source->retired_count++;
+
+	if (source->retired_count >= AVL_CONCURRENT_RECLAIM) {
+		avl_concurrent_reclaim(source);
+	}
+	pthread_mutex_unlock(&source->retire_lock);
+	return;
+}
+
+/**
+ * Returns the lock that guards the link to the first locked node of a
+ * path.
+ * @param source - pointer to a concurrent AVL
+ * @param path - a writer's path
+ * @return the root lock, or the lock of the parent of the first locked node
+ */
+static pthread_mutex_t* avl_cpath_anchor(avl_concurrent *source,
+		avl_cpath *path) {
+	pthread_mutex_t *anchor = &source->root_lock;
+
+	if (path->top > 0) {
+		anchor = &path->nodes[path->top - 1]->lock;
+	}
+	return anchor;
+}
+
+/**
+ * Locks the node in slot and adds it to the end of a path. The lock that
+ * guards slot must be held.
+ * @param path - a writer's path
+ * @param slot - link to the node
+ * @return the node
+ */
+static avl_cnode* avl_cpath_lock(avl_cpath *path, _Atomic(avl_cnode*) *slot) {
+	avl_cnode *node = atomic_load(slot);
+
+	pthread_mutex_lock(&node->lock);
+	path->slots[path->depth] = slot;
+	path->nodes[path->depth] = node;
+	path->depth++;
+	return node;
+}
+
+/**
+ * Lets go of every lock above the last node of a path and its parent:
+ * the update cannot change the last node's height, so nothing above its
+ * parent's link to it changes.
+ * @param source - pointer to a concurrent AVL
+ * @param path - a writer's path
+ */
+static void avl_cpath_trim(avl_concurrent *source, avl_cpath *path) {
+
+	while (path->top < path->depth - 1) {
+		pthread_mutex_unlock(avl_cpath_anchor(source, path));
+		path->top++;
+	}
+	return;
+}
+
+/**
+ * Lets go of every lock a path holds.
+ * @param source - pointer to a concurrent AVL
+ * @param path - a writer's path
+ */
+static void avl_cpath_unlock(avl_concurrent *source, avl_cpath *path) {
+	pthread_mutex_unlock(avl_cpath_anchor(source, path));
+
+	for (int d = path->top; d < path->depth; d++) {
+		pthread_mutex_unlock(&path->nodes[d]->lock);
+	}
+	return;
+}
+
+/**
+ * Looks for a routing node that can be unlinked among the locked nodes of
+ * a path. A rebalance can take a child from a node that was removed, so
+ * the node is left to be unlinked by a later pass.
+ * @param path - a writer's path
+ * @param unlinked - a node of the path that is out of the tree, or NULL
+ * @param routing - set to the item of a routing node to unlink
+ * @return TRUE if routing was set, FALSE otherwise
+ */
+static BOOLEAN avl_cpath_routing(avl_cpath *path, const avl_cnode *unlinked,
+		data_ptr routing) {
+	BOOLEAN found = FALSE;
+
+	for (int d = path->depth - 1; !found && d >= path->top; d--) {
+
+		if (path->nodes[d] != unlinked && avl_cnode_routing(path->nodes[d])) {
+			data_copy(routing, &path->nodes[d]->item);
+			found = TRUE;
+		}
+	}
+	return found;
+}
+
+/**
+ * Makes one locked pass for key: marks its node removed if item is not
+ * NULL, then unlinks the deepest routing node with at most one child from
+ * the last two nodes on the path and rebalances above it.
+ * @param source - pointer to a concurrent AVL
+ * @param key - the key to look for
+ * @param item - if key is removed, copy of the item removed; NULL to only
+ * unlink routing nodes
+ * @param removed - set to TRUE if key was removed, FALSE otherwise
+ * @param routing - set to the item of a routing node still to unlink
+ * @return TRUE if routing was set, FALSE otherwise
+ */
+static BOOLEAN avl_concurrent_remove_aux(avl_concurrent *source,
+		const data_ptr key, data_ptr item, BOOLEAN *removed,
+		data_ptr routing) {
+	avl_cpath path = { .top = 0, .depth = 0 };
+	_Atomic(avl_cnode*) *slot = &source->root;
+	BOOLEAN searching = TRUE;
+	BOOLEAN found = FALSE;
+
+	*removed = FALSE;
+	pthread_mutex_lock(&source->root_lock);
+
+	while (searching && atomic_load(slot) != NULL) {
+		avl_cnode *node = avl_cpath_lock(&path, slot);
+		int comp = data_compare(key, &node->item);
+
+		// A remove below a node takes at most 1 from a child's height, so
+		// a node with equal children keeps its height. The node holding
+		// key is not trimmed at: unlinking it changes its own height.
+		if (comp != 0 && avl_cnode_balance(node) == 0) {
+			avl_cpath_trim(source, &path);
+		}
+		if (comp < 0) {
+			slot = &node->left;
+		} else if (comp > 0) {
+			slot = &node->right;
+		} else {
+			if (item != NULL) {
+				*removed = atomic_load(&node->present);
+			}
+			if (*removed) {
+				data_copy(item, &node->item);
+				atomic_store(&node->present, FALSE);
+			}
+			searching = FALSE;
+		}
+	}
+	// Unlink the deepest routing node with at most one child, from the
+	// last two nodes on the path. Its height must not reach the first
+	// locked node, which stays locked only to keep its own height.
+	avl_cnode *unlinked = NULL;
+
+	for (int d = path.depth - 1; unlinked == NULL && d >= path.depth - 2;
+			d--) {
+
+		if (d >= 0 && (d > path.top || d == 0)
+				&& avl_cnode_routing(path.nodes[d])) {
+			unlinked = path.nodes[d];
+			avl_cnode_unlink(path.slots[d]);
+
+			for (int above = d - 1; above >= path.top; above--) {
+
+				if (avl_cnode_rebalance_remove(path.slots[above], routing)) {
+					found = TRUE;
+				}
+			}
+		}
+	}
+	// Removes and rotations can leave other routing nodes on the path. A
+	// pass that only unlinks them goes on while it unlinks one.
+	if (!found && (item != NULL || unlinked != NULL)) {
+		found = avl_cpath_routing(&path, unlinked, routing);
+	}
+	avl_cpath_unlock(source, &path);
+
+	if (unlinked != NULL) {
+		avl_concurrent_retire(source, unlinked);
+	}
+	return found;
+}
+
+/**
+ * Unlinks routing nodes with at most one child, starting from the one
+ * holding routing, until a pass finds no more.
+ * @param source - pointer to a concurrent AVL
+ * @param routing - item of a routing node to unlink
+ */
+static void avl_concurrent_unroute(avl_concurrent *source, data_ptr routing) {
+	BOOLEAN removed = FALSE;
+	data_value next;
+
+	while (avl_concurrent_remove_aux(source, routing, NULL, &removed, &next)) {
+		data_copy(routing, &next);
+	}
+	return;
+}
+
+/**
+ * Makes one optimistic search for key. Fails if a node on the search path
+ * changed while it was being read. Acquire loads keep each version check
+ * after the reads it validates.
+ * @param source - pointer to a concurrent AVL
+ * @param key - the key to look for
+ * @param item - if key is found, copy of the item retrieved
+ * @param retrieved - set to TRUE if the key is found, FALSE otherwise
+ * @return TRUE if the search completed, FALSE if it must be retried
+ */
+static BOOLEAN avl_cnode_attempt_retrieve(avl_concurrent *source,
+		const data_ptr key, data_ptr item, BOOLEAN *retrieved) {
+	avl_cnode *node = AVL_ACQUIRE(&source->root);
+	BOOLEAN complete = TRUE;
+
+	*retrieved = FALSE;
+
+	if (node != NULL) {
+		unsigned long version = AVL_ACQUIRE(&node->version);
+
+		complete = !(version & AVL_CNODE_BUSY)
+				&& AVL_ACQUIRE(&source->root) == node;
+
+		while (complete && node != NULL) {
+			int comp = data_compare(key, &node->item);
+
+			if (comp == 0) {
+				*retrieved = AVL_ACQUIRE(&node->present);
+
+				if (*retrieved) {
+					data_copy(item, &node->item);
+				}
+				node = NULL;
+			} else {
+				_Atomic(avl_cnode*) *link =
+						comp < 0 ? &node->left : &node->right;
+				avl_cnode *child = AVL_ACQUIRE(link);
+				unsigned long child_version = 0;
+
+				if (child != NULL) {
+					// Read the child's version before validating the link to it.
+					child_version = AVL_ACQUIRE(&child->version);
+					complete = !(child_version & AVL_CNODE_BUSY)
+							&& AVL_ACQUIRE(link) == child;
+				}
+				complete = complete
+						&& AVL_ACQUIRE(&node->version) == version;
+				node = child;
+				version = child_version;
+			}
+		}
+	}
+	return complete;
+}
+
+//--------------------------------------------------------------------
+// Functions
+
+avl_concurrent* avl_concurrent_initialize() {
+	avl_concurrent *source = malloc(sizeof *source);
+	atomic_init(&source->root, NULL);
+	atomic_init(&source->count, 0);
+	pthread_mutex_init(&source->root_lock, NULL);
+	pthread_mutex_init(&source->retire_lock, NULL);
+	source->retired = NULL;
+	source->retired_count = 0;
+	return source;
+}
+
+void avl_concurrent_free(avl_concurrent **source) {
+	avl_cnode_free_aux(atomic_load(&(*source)->root));
+
+	while ((*source)->retired != NULL) {
+		avl_cnode *node = (*source)->retired;
+		(*source)->retired = node->retired;
+		avl_cnode_free(node);
+	}
+	pthread_mutex_destroy(&(*source)->retire_lock);
+	pthread_mutex_destroy(&(*source)->root_lock);
+	free(*source);
+	*source = NULL;
+	return;
+}
+
+int avl_concurrent_count(const avl_concurrent *source) {
+	return atomic_load(&source->count);
+}
+
+BOOLEAN avl_concurrent_insert(avl_concurrent *source, const data_ptr item) {
+	avl_cpath path = { .top = 0, .depth = 0 };
+	_Atomic(avl_cnode*) *slot = &source->root;
+	BOOLEAN inserted = FALSE;
+	BOOLEAN searching = TRUE;
+	BOOLEAN routed = FALSE;
+	data_value routing;
+
+	pthread_mutex_lock(&source->root_lock);
+
+	while (searching && atomic_load(slot) != NULL) {
+		avl_cnode *node = avl_cpath_lock(&path, slot);
+
+		// An insert adds at most 1 to a child's height. A node with
+		// unequal children then either evens out or is rotated back to
+		// its old height.
+		if (avl_cnode_balance(node) != 0) {
+			avl_cpath_trim(source, &path);
+		}
+		int comp = data_compare(item, &node->item);
+
+		if (comp < 0) {
+			slot = &node->left;
+		} else if (comp > 0) {
+			slot = &node->right;
+		} else {
+			// A routing node matching item is made present again.
+			inserted = !atomic_load(&node->present);
+			atomic_store(&node->present, TRUE);
+			searching = FALSE;
+		}
+	}
+	if (searching) {
+		// Add a new node containing a copy of item, and rebalance up to
+		// the first locked node.
+		atomic_store(slot, avl_cnode_initialize(item));
+		inserted = TRUE;
+
+		for (int d = path.depth - 1; d >= path.top; d--) {
+			avl_cnode_rebalance(path.slots[d]);
+		}
+		routed = avl_cpath_routing(&path, NULL, &routing);
+	}
+	avl_cpath_unlock(source, &path);
+
+	if (routed) {
+		avl_concurrent_unroute(source, &routing);
+	}
+	if (inserted) {
+		atomic_fetch_add(&source->count, 1);
+	}
+	return inserted;
+}
+
+BOOLEAN avl_concurrent_retrieve(avl_concurrent *source, const data_ptr key,
+		data_ptr item) {
+	BOOLEAN retrieved = FALSE;
+	avl_epoch_slot *slot = avl_epoch_enter();
+
+	while (!avl_cnode_attempt_retrieve(source, key, item, &retrieved)) {
+		// A writer moved a node on the path: search again from the root.
+	}
+	avl_epoch_exit(slot);
+	return retrieved;
+}
+
+BOOLEAN avl_concurrent_remove(avl_concurrent *source, const data_ptr key,
+		data_ptr item) {
+	BOOLEAN removed = FALSE;
+	data_value routing;
+
+	if (avl_concurrent_remove_aux(source, key, item, &removed, &routing)) {
+		avl_concurrent_unroute(source, &routing);
+	}
+	if (removed) {
+		atomic_fetch_sub(&source->count, 1);
+	}
+	return removed;
+}
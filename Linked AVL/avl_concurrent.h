@@ -0,0 +1,130 @@
+/**
+ * -------------------------------------
+ * @file  avl_concurrent.h
+ * Concurrent AVL Header File
+ * -------------------------------------
+ * @author Filip Stanojcic
+ *
+ * @version 2026-10-18
+ *
+ * Readers take no locks: each node carries a version number that a
+ * writer changes whenever the node is rotated down or unlinked, and a
+ * reader that sees a version change along its path retries the search.
+ * Writers lock nodes hand over hand down their search path, and let go
+ * of every lock above the deepest node whose height the update cannot
+ * change, so writers in different subtrees run side by side. Readers
+ * never touch these locks. A remove unlinks its node if it has at most
+ * one child, and otherwise leaves it as a routing node. A routing node
+ * that a later remove or rotation leaves with at most one child is
+ * unlinked by a further pass, so the tree holds no more routing nodes
+ * than it has removed nodes with two children: removing every item leaves
+ * it empty. Unlinked nodes are freed once no reader that may reach them
+ * is still running.
+ * Each thread that retrieves holds one of AVL_CONCURRENT_MAX_THREADS
+ * epoch slots from its first retrieve until it exits.
+ *
+ * Link with -pthread.
+ */
+#ifndef AVL_CONCURRENT_H_
+#define AVL_CONCURRENT_H_
+
+// Includes
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "data.h"
+
+#define AVL_CONCURRENT_MAX_THREADS 128 // Most live threads that retrieve
+#define AVL_CONCURRENT_RECLAIM 64      // Retired nodes kept before a reclaim pass
+#define AVL_CONCURRENT_DEPTH 64        // Longest path a writer locks
+#define AVL_CONCURRENT_ALIGN 64        // Cache line size
+
+// typedefs
+/**
+ * Concurrent AVL node. The fields readers use come first, and nodes are
+ * aligned to AVL_CONCURRENT_ALIGN, so a reader touches one cache line per
+ * node.
+ */
+typedef struct AVL_CNODE {
+    _Atomic(struct AVL_CNODE*) left;  // Pointer to the left child.
+    _Atomic(struct AVL_CNODE*) right; // Pointer to the right child.
+    atomic_ulong version;            // Changes when the node is rotated or unlinked.
+    atomic_int present;              // 0 for a routing node left by a remove.
+    data_value item;                 // The node data - never changes.
+    int height;                      // Height of the current node (writers only).
+    struct AVL_CNODE *retired;       // Next node waiting to be freed.
+    unsigned long epoch;             // Epoch in which the node was unlinked.
+    pthread_mutex_t lock;            // Held to change the node's links or height.
+} avl_cnode;
+
+/**
+ * Concurrent AVL header
+ */
+typedef struct {
+    _Atomic(avl_cnode*) root;        // Pointer to root node of the AVL.
+    atomic_int count;                // Number of items in the AVL.
+    pthread_mutex_t root_lock;       // Held to change root, as a node's lock.
+    pthread_mutex_t retire_lock;     // Guards retired and retired_count.
+    avl_cnode *retired;              // Unlinked nodes not yet freed.
+    int retired_count;               // Number of nodes in retired.
+} avl_concurrent;
+
+// Prototypes
+
+/**
+ * Initializes a concurrent AVL.
+ *
+ * @return pointer to a concurrent AVL
+ */
+avl_concurrent* avl_concurrent_initialize();
+
+/**
+ * Frees all parts of a concurrent AVL. No other thread may be using it.
+ *
+ * @param source - pointer to a concurrent AVL
+ */
+void avl_concurrent_free(avl_concurrent **source);
+
+/**
+ * Returns number of items in a concurrent AVL.
+ *
+ * @param source - pointer to a concurrent AVL
+ * @return - number of items in AVL
+ */
+int avl_concurrent_count(const avl_concurrent *source);
+
+/**
+ * Inserts a copy of an item into a concurrent AVL.
+ *
+ * @param source - pointer to a concurrent AVL
+ * @param item - pointer to the item to insert
+ * @return - TRUE if item inserted, FALSE otherwise
+ */
+BOOLEAN avl_concurrent_insert(avl_concurrent *source, const data_ptr item);
+
+/**
+ * Retrieves a copy of a value matching key in a concurrent AVL without
+ * taking any lock.
+ *
+ * @param source - pointer to a concurrent AVL
+ * @param key - key value to search for
+ * @param item - pointer to copy of the item retrieved
+ * @return - TRUE if item retrieved, FALSE otherwise (key not found)
+ */
+BOOLEAN avl_concurrent_retrieve(avl_concurrent *source, const data_ptr key,
+        data_ptr item);
+
+/**
+ * Removes a value matching key in a concurrent AVL.
+ *
+ * @param source - pointer to a concurrent AVL
+ * @param key - key value to search for
+ * @param item - pointer to copy of the item removed
+ * @return - TRUE if item removed, FALSE otherwise (key not found)
+ */
+BOOLEAN avl_concurrent_remove(avl_concurrent *source, const data_ptr key,
+        data_ptr item);
+
+#endif /* AVL_CONCURRENT_H_ */
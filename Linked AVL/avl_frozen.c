@@ -0,0 +1,191 @@
+/**
+ * -------------------------------------
+ * @file  avl_frozen.c
+ * Frozen AVL Index Source Code File
+ * -------------------------------------
+ * @author Filip Stanojcic
+ *
+ * @version 2026-10-18
+ *
+ */
+#define _POSIX_C_SOURCE 200809L // mmap, fstat
+
+// Includes
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "avl_frozen.h"
+
+#if defined(__GNUC__)
+#define AVL_PREFETCH(address) __builtin_prefetch(address)
+#else
+#define AVL_PREFETCH(address) ((void) (address))
+#endif
+
+#define AVL_FROZEN_MAGIC "AVLFRZ2"
+#define AVL_FROZEN_ALIGN 64 // Cache line size: keys starts on a line.
+// Items per 64-byte cache line: the descendants log2(this) levels down.
+#define AVL_FROZEN_LINE (AVL_FROZEN_ALIGN / sizeof *((data_ptr) NULL))
+
+/**
+ * Frozen index file header - followed by count + 1 items. It is one cache
+ * line long, so the items of a mapped file start on a line as well.
+ */
+typedef struct {
+	char magic[8];           // AVL_FROZEN_MAGIC
+	long long count;         // Number of items in the index.
+	long long item_size;     // Size of one item in bytes.
+	char padding[AVL_FROZEN_ALIGN - 8 - 2 * sizeof(long long)];
+} avl_frozen_header;
+
+_Static_assert(sizeof(avl_frozen_header) == AVL_FROZEN_ALIGN,
+		"avl_frozen_header must be one cache line");
+
+// Local Functions
+
+/**
+ * Copies items in inorder into the Eytzinger positions of the subtree
+ * rooted at k.
+ *
+ * @param source - pointer to a frozen index
+ * @param items - array of items in inorder
+ * @param index - current index in items
+ * @param k - Eytzinger position of the subtree root
+ * @return - the updated index
+ */
+static int avl_frozen_fill(avl_frozen *source, data_ptr *items, int index,
+		size_t k) {
+
+	if (k <= (size_t) source->count) {
+		index = avl_frozen_fill(source, items, index, 2 * k);
+		data_copy(source->keys + k, items[index]);
+		index++;
+		index = avl_frozen_fill(source, items, index, 2 * k + 1);
+	}
+	return index;
+}
+
+//--------------------------------------------------------------------
+// Functions
+
+avl_frozen* avl_freeze(const avl_linked *source) {
+	avl_frozen *frozen = malloc(sizeof *frozen);
+	data_ptr *items = malloc(source->count * sizeof *items);
+	// aligned_alloc needs a size that is a multiple of the alignment.
+	size_t size = (source->count + 1) * sizeof *frozen->keys;
+	size = (size + AVL_FROZEN_ALIGN - 1) / AVL_FROZEN_ALIGN * AVL_FROZEN_ALIGN;
+
+	frozen->count = source->count;
+	frozen->keys = aligned_alloc(AVL_FROZEN_ALIGN, size);
+	// keys[0] is never searched but is saved, so give it a fixed value.
+	memset(frozen->keys, 0, sizeof *frozen->keys);
+	frozen->mapping = NULL;
+	frozen->mapping_size = 0;
+	avl_inorder(source, items);
+	avl_frozen_fill(frozen, items, 0, 1);
+	free(items);
+	return frozen;
+}
+
+void avl_frozen_free(avl_frozen **source) {
+
+	if ((*source)->mapping != NULL) {
+		munmap((*source)->mapping, (*source)->mapping_size);
+	} else {
+		free((*source)->keys);
+	}
+	free(*source);
+	*source = NULL;
+	return;
+}
+
+int avl_frozen_count(const avl_frozen *source) {
+	return source->count;
+}
+
+BOOLEAN avl_frozen_retrieve(const avl_frozen *source, const data_ptr key,
+		data_ptr item) {
+	BOOLEAN retrieved = FALSE;
+	size_t n = source->count;
+	size_t k = 1;
+
+	// Branch-free descent: go right whenever key is greater than keys[k].
+	while (k <= n) {
+		AVL_PREFETCH(source->keys + k * AVL_FROZEN_LINE);
+		k = 2 * k + (data_compare(key, source->keys + k) > 0);
+	}
+	// Undo the right turns after the last left turn: k is the lower bound.
+	while (k & 1) {
+		k >>= 1;
+	}
+	k >>= 1;
+
+	if (k != 0 && data_compare(key, source->keys + k) == 0) {
+		data_copy(item, source->keys + k);
+		retrieved = TRUE;
+	}
+	return retrieved;
+}
+
+BOOLEAN avl_frozen_save(const avl_frozen *source, const char *filename) {
+	BOOLEAN saved = FALSE;
+	FILE *file = fopen(filename, "wb");
+
+	if (file != NULL) {
+		avl_frozen_header header;
+		memset(&header, 0, sizeof header);
+		memcpy(header.magic, AVL_FROZEN_MAGIC, sizeof header.magic);
+		header.count = source->count;
+		header.item_size = sizeof *source->keys;
+
+		saved = fwrite(&header, sizeof header, 1, file) == 1
+				&& fwrite(source->keys, sizeof *source->keys,
+						source->count + 1, file)
+						== (size_t) source->count + 1;
+		saved = (fclose(file) == 0) && saved;
+	}
+	return saved;
+}
+
+avl_frozen* avl_frozen_load(const char *filename) {
+	avl_frozen *frozen = NULL;
+	int fd = open(filename, O_RDONLY);
+
+	if (fd >= 0) {
+		struct stat status;
+		avl_frozen_header header;
+
+		// Check the header against the file before mapping it: count must
+		// fit an int with room for keys[0], and the file must hold exactly
+		// count + 1 items after the header.
+		if (fstat(fd, &status) == 0
+				&& read(fd, &header, sizeof header) == sizeof header
+				&& memcmp(header.magic, AVL_FROZEN_MAGIC, sizeof header.magic)
+						== 0 && header.item_size == sizeof *frozen->keys
+				&& header.count >= 0 && header.count < INT_MAX
+				&& (unsigned long long) status.st_size
+						== sizeof header
+								+ (unsigned long long) (header.count + 1)
+										* sizeof *frozen->keys) {
+			void *mapping = mmap(NULL, status.st_size, PROT_READ, MAP_PRIVATE,
+					fd, 0);
+
+			if (mapping != MAP_FAILED) {
+				frozen = malloc(sizeof *frozen);
+				frozen->count = (int) header.count;
+				frozen->keys = (data_ptr) ((char*) mapping + sizeof header);
+				frozen->mapping = mapping;
+				frozen->mapping_size = status.st_size;
+			}
+		}
+		// The mapping stays valid after the file is closed.
+		close(fd);
+	}
+	return frozen;
+}
@@ -0,0 +1,92 @@
+/**
+ * -------------------------------------
+ * @file  avl_frozen.h
+ * Frozen AVL Index Header File
+ * -------------------------------------
+ * @author Filip Stanojcic
+ *
+ * @version 2026-10-18
+ *
+ * A read-only copy of an AVL with its items stored inline in one array in
+ * Eytzinger (breadth-first) order: the children of keys[k] are keys[2k]
+ * and keys[2k + 1]. A search is a loop over array indexes with no
+ * pointers to follow, and the nodes four levels ahead share one cache
+ * line, so they can be prefetched. A frozen index can be saved to a file
+ * and loaded back with mmap.
+ */
+#ifndef AVL_FROZEN_H_
+#define AVL_FROZEN_H_
+
+// Includes
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "data.h"
+#include "avl_linked.h"
+
+// typedefs
+/**
+ * Frozen AVL header
+ */
+typedef struct {
+    int count;               // Number of items in the index.
+    data_ptr keys;           // Items in Eytzinger order from keys[1]; keys[0] is 0.
+                             // Starts on a 64-byte cache line.
+    void *mapping;           // File mapping holding keys, NULL if keys is allocated.
+    size_t mapping_size;     // Size of mapping in bytes.
+} avl_frozen;
+
+// Prototypes
+
+/**
+ * Creates a frozen index from the contents of an AVL. The AVL is unchanged.
+ *
+ * @param source - pointer to a AVL
+ * @return - pointer to a frozen index
+ */
+avl_frozen* avl_freeze(const avl_linked *source);
+
+/**
+ * Frees a frozen index.
+ *
+ * @param source - pointer to a frozen index
+ */
+void avl_frozen_free(avl_frozen **source);
+
+/**
+ * Returns number of items in a frozen index.
+ *
+ * @param source - pointer to a frozen index
+ * @return - number of items in the index
+ */
+int avl_frozen_count(const avl_frozen *source);
+
+/**
+ * Retrieves a copy of a value matching key in a frozen index.
+ *
+ * @param source - pointer to a frozen index
+ * @param key - key value to search for
+ * @param item - pointer to copy of the item retrieved
+ * @return - TRUE if item retrieved, FALSE otherwise (key not found)
+ */
+BOOLEAN avl_frozen_retrieve(const avl_frozen *source, const data_ptr key,
+        data_ptr item);
+
+/**
+ * Writes a frozen index to a file.
+ *
+ * @param source - pointer to a frozen index
+ * @param filename - name of the file to write
+ * @return - TRUE if the file was written, FALSE otherwise
+ */
+BOOLEAN avl_frozen_save(const avl_frozen *source, const char *filename);
+
+/**
+ * Maps a frozen index saved by avl_frozen_save into memory.
+ *
+ * @param filename - name of the file to read
+ * @return - pointer to a frozen index, NULL if the file is not a valid index
+ */
+avl_frozen* avl_frozen_load(const char *filename);
+
+#endif /* AVL_FROZEN_H_ */
@@ -0,0 +1,259 @@
+/**
+ * -------------------------------------
+ * @file  avl_interval.c
+ * AVL Interval Tree Source Code File
+ * -------------------------------------
+ * @author Filip Stanojcic
+ *
+ * @version 2026-10-18
+ *
+ */
+// Includes
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "avl_interval.h"
+
+// Local Functions
+
+/**
+ * Recomputes the largest high endpoint of a node's subtree from the node
+ * and its children. Used as the AVL augment function.
+ * @param node - The node to process.
+ */
+static void avl_interval_augment(avl_node *node) {
+	avl_interval_node *interval = (avl_interval_node*) node;
+	data_copy(&interval->max, &interval->high);
+
+	if (node->left != NULL) {
+		data_ptr max = &((avl_interval_node*) node->left)->max;
+
+		if (data_compare(max, &interval->max) > 0) {
+			data_copy(&interval->max, max);
+		}
+	}
+	if (node->right != NULL) {
+		data_ptr max = &((avl_interval_node*) node->right)->max;
+
+		if (data_compare(max, &interval->max) > 0) {
+			data_copy(&interval->max, max);
+		}
+	}
+	return;
+}
+
+/**
+ * Compares an interval to the interval in a node, by low then high.
+ * @param low - pointer to the start of the interval
+ * @param high - pointer to the end of the interval
+ * @param node - The node to compare to.
+ * @return < 0, 0 or > 0 as the interval sorts before, with or after node
+ */
+static int avl_interval_compare(const data_ptr low, const data_ptr high,
+		const avl_node *node) {
+	const avl_interval_node *interval = (const avl_interval_node*) node;
+	int comp = data_compare(low, (data_ptr) &interval->low);
+
+	if (comp == 0) {
+		comp = data_compare(high, (data_ptr) &interval->high);
+	}
+	return comp;
+}
+
+/**
+ * Frees a node and its children.
+ * @param node - The node to process
+ */
+static void avl_interval_free_aux(avl_node *node) {
+
+	if (node != NULL) {
+		avl_interval_free_aux(node->left);
+		avl_interval_free_aux(node->right);
+		free(node);
+	}
+	return;
+}
+
+/**
+ * Inserts the interval [low, high] below node.
+ * @param source - pointer to an interval tree
+ * @param node - The node to process.
+ * @param low - pointer to the start of the interval
+ * @param high - pointer to the end of the interval
+ * @return TRUE if the interval is inserted, FALSE otherwise.
+ */
+static BOOLEAN avl_interval_insert_aux(avl_interval_tree *source,
+		avl_node **node, const data_ptr low, const data_ptr high) {
+	BOOLEAN inserted = FALSE;
+
+	if (*node == NULL) {
+		avl_interval_node *interval = malloc(sizeof *interval);
+		data_copy(&interval->low, low);
+		data_copy(&interval->high, high);
+		interval->node.item = &interval->low;
+		interval->node.height = 1;
+		interval->node.left = NULL;
+		interval->node.right = NULL;
+		*node = &interval->node;
+		source->count++;
+		inserted = TRUE;
+	} else {
+		int comp = avl_interval_compare(low, high, *node);
+
+		if (comp < 0) {
+			inserted = avl_interval_insert_aux(source, &(*node)->left, low,
+					high);
+		} else if (comp > 0) {
+			inserted = avl_interval_insert_aux(source, &(*node)->right, low,
+					high);
+		}
+	}
+	if (inserted) {
+		// Updates the height and max, and rotates if necessary.
+		avl_node_rebalance_augmented(node, avl_interval_augment);
+	}
+	return inserted;
+}
+
+/**
+ * Unlinks the leftmost node below node.
+ * @param node - The node to process, must not be empty.
+ * @return the unlinked node
+ */
+static avl_node* avl_interval_remove_min(avl_node **node) {
+	avl_node *min = NULL;
+
+	if ((*node)->left == NULL) {
+		min = *node;
+		*node = min->right;
+	} else {
+		min = avl_interval_remove_min(&(*node)->left);
+		avl_node_rebalance_augmented(node, avl_interval_augment);
+	}
+	return min;
+}
+
+/**
+ * Attempts to find the interval [low, high] below node. Unlinks and frees
+ * its node if found.
+ * @param source - pointer to an interval tree
+ * @param node - The node to process.
+ * @param low - pointer to the start of the interval
+ * @param high - pointer to the end of the interval
+ * @return TRUE if the interval is found and removed, FALSE otherwise.
+ */
+static BOOLEAN avl_interval_remove_aux(avl_interval_tree *source,
+		avl_node **node, const data_ptr low, const data_ptr high) {
+	BOOLEAN removed = FALSE;
+
+	if (*node != NULL) {
+		int comp = avl_interval_compare(low, high, *node);
+
+		if (comp < 0) {
+			removed = avl_interval_remove_aux(source, &(*node)->left, low,
+					high);
+		} else if (comp > 0) {
+			removed = avl_interval_remove_aux(source, &(*node)->right, low,
+					high);
+		} else {
+			avl_node *temp = *node;
+
+			if (temp->left == NULL || temp->right == NULL) {
+				*node = temp->left ? temp->left : temp->right;
+			} else {
+				// Relink the successor node in place of the removed one.
+				avl_node *successor = avl_interval_remove_min(&temp->right);
+				successor->left = temp->left;
+				successor->right = temp->right;
+				*node = successor;
+			}
+			free(temp);
+			source->count--;
+			removed = TRUE;
+		}
+		if (removed && *node != NULL) {
+			avl_node_rebalance_augmented(node, avl_interval_augment);
+		}
+	}
+	return removed;
+}
+
+/**
+ * Reports the intervals below node that overlap [low, high]. Skips
+ * subtrees whose largest high is below low, and right subtrees once a
+ * node starts after high.
+ * @param node - The node to process.
+ * @param low - pointer to the start of the range
+ * @param high - pointer to the end of the range
+ * @param report - function called for each interval found, may be NULL
+ * @param context - pointer passed to report
+ * @return number of intervals found
+ */
+static int avl_interval_overlap_aux(const avl_node *node, const data_ptr low,
+		const data_ptr high, avl_interval_callback report, void *context) {
+	int found = 0;
+
+	if (node != NULL) {
+		avl_interval_node *interval = (avl_interval_node*) node;
+
+		if (data_compare(&interval->max, low) >= 0) {
+			found += avl_interval_overlap_aux(node->left, low, high, report,
+					context);
+
+			if (data_compare(&interval->low, high) <= 0) {
+
+				if (data_compare(&interval->high, low) >= 0) {
+					if (report != NULL) {
+						report(&interval->low, &interval->high, context);
+					}
+					found++;
+				}
+				found += avl_interval_overlap_aux(node->right, low, high,
+						report, context);
+			}
+		}
+	}
+	return found;
+}
+
+//--------------------------------------------------------------------
+// Functions
+
+avl_interval_tree* avl_interval_initialize() {
+	avl_interval_tree *source = malloc(sizeof *source);
+	source->count = 0;
+	source->root = NULL;
+	return source;
+}
+
+void avl_interval_free(avl_interval_tree **source) {
+	avl_interval_free_aux((*source)->root);
+	free(*source);
+	*source = NULL;
+	return;
+}
+
+int avl_interval_count(const avl_interval_tree *source) {
+	return source->count;
+}
+
+BOOLEAN avl_interval_insert(avl_interval_tree *source, const data_ptr low,
+		const data_ptr high) {
+	return (avl_interval_insert_aux(source, &source->root, low, high));
+}
+
+BOOLEAN avl_interval_remove(avl_interval_tree *source, const data_ptr low,
+		const data_ptr high) {
+	return (avl_interval_remove_aux(source, &source->root, low, high));
+}
+
+int avl_interval_stab(const avl_interval_tree *source, const data_ptr point,
+		avl_interval_callback report, void *context) {
+	return (avl_interval_overlap_aux(source->root, point, point, report,
+			context));
+}
+
+int avl_interval_overlap(const avl_interval_tree *source, const data_ptr low,
+		const data_ptr high, avl_interval_callback report, void *context) {
+	return (avl_interval_overlap_aux(source->root, low, high, report, context));
+}
@@ -0,0 +1,127 @@
+/**
+ * -------------------------------------
+ * @file  avl_interval.h
+ * AVL Interval Tree Header File
+ * -------------------------------------
+ * @author Filip Stanojcic
+ *
+ * @version 2026-10-18
+ *
+ * An AVL of closed intervals [low, high] ordered by low, then high. Each
+ * node also keeps the largest high endpoint in its subtree, updated
+ * through the AVL rotations, so a query skips every subtree that ends
+ * before the range it looks for. A query visits O(log n) nodes for each
+ * of its k results and never more than all n, so takes O(min(n, k log n)).
+ */
+#ifndef AVL_INTERVAL_H_
+#define AVL_INTERVAL_H_
+
+// Includes
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "data.h"
+#include "avl_linked.h"
+
+// typedefs
+/**
+ * AVL interval tree node
+ */
+typedef struct {
+    avl_node node;           // AVL links: node.item points to low.
+    data_value low;          // Start of the interval.
+    data_value high;         // End of the interval.
+    data_value max;          // Largest high in the subtree.
+} avl_interval_node;
+
+/**
+ * AVL interval tree header
+ */
+typedef struct {
+    int count;               // Number of intervals in the tree.
+    avl_node *root;          // Pointer to root node of the tree.
+} avl_interval_tree;
+
+/**
+ * Function called by the queries for each interval found.
+ *
+ * low - pointer to the start of the interval
+ * high - pointer to the end of the interval
+ * context - pointer passed to the query
+ */
+typedef void (*avl_interval_callback)(data_ptr low, data_ptr high,
+        void *context);
+
+// Prototypes
+
+/**
+ * Initializes an interval tree.
+ *
+ * @return pointer to an interval tree
+ */
+avl_interval_tree* avl_interval_initialize();
+
+/**
+ * Frees all parts of an interval tree.
+ *
+ * @param source - pointer to an interval tree
+ */
+void avl_interval_free(avl_interval_tree **source);
+
+/**
+ * Returns number of intervals in an interval tree.
+ *
+ * @param source - pointer to an interval tree
+ * @return - number of intervals in the tree
+ */
+int avl_interval_count(const avl_interval_tree *source);
+
+/**
+ * Inserts a copy of the interval [low, high] into an interval tree. Only
+ * one of each interval may be in the tree.
+ *
+ * @param source - pointer to an interval tree
+ * @param low - pointer to the start of the interval
+ * @param high - pointer to the end of the interval, not less than low
+ * @return - TRUE if interval inserted, FALSE otherwise
+ */
+BOOLEAN avl_interval_insert(avl_interval_tree *source, const data_ptr low,
+        const data_ptr high);
+
+/**
+ * Removes the interval [low, high] from an interval tree.
+ *
+ * @param source - pointer to an interval tree
+ * @param low - pointer to the start of the interval
+ * @param high - pointer to the end of the interval
+ * @return - TRUE if interval removed, FALSE otherwise (not found)
+ */
+BOOLEAN avl_interval_remove(avl_interval_tree *source, const data_ptr low,
+        const data_ptr high);
+
+/**
+ * Reports every interval that contains point, in order of low.
+ *
+ * @param source - pointer to an interval tree
+ * @param point - pointer to the point to look for
+ * @param report - function called for each interval found, may be NULL
+ * @param context - pointer passed to report
+ * @return - number of intervals found
+ */
+int avl_interval_stab(const avl_interval_tree *source, const data_ptr point,
+        avl_interval_callback report, void *context);
+
+/**
+ * Reports every interval that overlaps [low, high], in order of low.
+ *
+ * @param source - pointer to an interval tree
+ * @param low - pointer to the start of the range
+ * @param high - pointer to the end of the range
+ * @param report - function called for each interval found, may be NULL
+ * @param context - pointer passed to report
+ * @return - number of intervals found
+ */
+int avl_interval_overlap(const avl_interval_tree *source, const data_ptr low,
+        const data_ptr high, avl_interval_callback report, void *context);
+
+#endif /* AVL_INTERVAL_H_ */
@@ -14,8 +14,47 @@
 
 #include "avl_linked.h"
 
+#if defined(__GNUC__)
+#define AVL_PREFETCH(address) __builtin_prefetch(address)
+#else
+#define AVL_PREFETCH(address) ((void) (address))
+#endif
+
 // Local Functions
 
+#ifdef AVL_MERKLE
+/**
+ * Helper function to determine the subtree hash of node - handles empty node.
+ * @param node - The node to process.
+ * @return The hash of the subtree rooted at node.
+ */
+static unsigned long long avl_node_hash(const avl_node *node) {
+	unsigned long long hash = 0;
+
+	if (node != NULL) {
+		hash = node->hash;
+	}
+	return (hash);
+}
+
+/**
+ * Updates the subtree hash of a node from its item, its height and its
+ * children's hashes. The children are weighted differently so that the
+ * hash also depends on the shape of the subtree. The node's height must
+ * already be up to date.
+ * @param node - The node to process.
+ */
+static void avl_update_hash(avl_node *node) {
+	unsigned long long hash = data_hash(node->item);
+
+	hash ^= (unsigned long long) node->height * 0x94d049bb133111ebULL;
+	hash ^= avl_node_hash(node->left) * 0x9e3779b97f4a7c15ULL;
+	hash ^= avl_node_hash(node->right) * 0xc2b2ae3d27d4eb4fULL;
+	node->hash = (hash ^ (hash >> 29)) * 0xbf58476d1ce4e5b9ULL;
+	return;
+}
+#endif
+
 /**
  * Initializes a new AVL node with a copy of item.
  *
@@ -31,6 +70,9 @@ static avl_node* avl_node_initialize(const data_ptr item) {
 	node->height = 1;
 	node->left = NULL;
 	node->right = NULL;
+#ifdef AVL_MERKLE
+	avl_update_hash(node);
+#endif
 	return node;
 }
 
@@ -48,9 +90,10 @@ static int avl_node_height(const avl_node *node) {
 	return (height);
 }
 
+
 /**
  * Updates the height of a node. Its height is the max of the heights of its
- * child nodes, plus 1.
+ * child nodes, plus 1. With AVL_MERKLE, also updates the node's hash.
  * @param node - The node to process.
  */
 static void avl_update_height(avl_node *node) {
@@ -62,6 +105,9 @@ static void avl_update_height(avl_node *node) {
 	} else {
 		node->height = right_height + 1;
 	}
+#ifdef AVL_MERKLE
+	avl_update_hash(node);
+#endif
 	return;
 }
 
@@ -98,9 +144,10 @@ int max(int x, int y) {
 /**
  * Performs a left rotation around node.
  * @param node - the node to process
+ * @param augment - if not NULL, updates node data kept by a derived tree
  * @return Pointer to new root of subsource
  */
-static avl_node* avl_rotate_left(avl_node *node) {
+static avl_node* avl_rotate_left(avl_node *node, avl_augment augment) {
 	avl_node *newRoot = node->right;
 	node->right = newRoot->left;
 	newRoot->left = node;
@@ -109,15 +156,21 @@ static avl_node* avl_rotate_left(avl_node *node) {
 	avl_update_height(node);
 	avl_update_height(newRoot);
 
+	if (augment != NULL) {
+		augment(node);
+		augment(newRoot);
+	}
+
 	return newRoot;
 }
 
 /**
  * Performs a right rotation around node.
  * @param node - the node to process
+ * @param augment - if not NULL, updates node data kept by a derived tree
  * @return Pointer to new root of subsource.
  */
-static avl_node* avl_rotate_right(avl_node *node) {
+static avl_node* avl_rotate_right(avl_node *node, avl_augment augment) {
 	avl_node *newRoot = node->left;
 	node->left = newRoot->right;
 	newRoot->right = node;
@@ -126,17 +179,26 @@ static avl_node* avl_rotate_right(avl_node *node) {
 	avl_update_height(node);
 	avl_update_height(newRoot);
 
+	if (augment != NULL) {
+		augment(node);
+		augment(newRoot);
+	}
+
 	return newRoot;
 }
 
 /**
  * Rebalances a node according to AVL rules.
  * @param node - the node to process
+ * @param augment - if not NULL, updates node data kept by a derived tree
  */
-static void avl_rebalance(avl_node **node) {
+static void avl_rebalance_augmented(avl_node **node, avl_augment augment) {
 	// Update the height of the current node.
 	avl_update_height(*node);
 
+	if (augment != NULL) {
+		augment(*node);
+	}
 	// Check the balance factor
 	int balance = avl_balance(*node);
 
@@ -144,22 +206,31 @@ static void avl_rebalance(avl_node **node) {
 	if (balance > 1) {
 		// Determine if a left-right rotation is needed
 		if (avl_balance((*node)->left) < 0) {
-			(*node)->left = avl_rotate_left((*node)->left);
+			(*node)->left = avl_rotate_left((*node)->left, augment);
 		}
 		// Perform a right rotation
-		*node = avl_rotate_right(*node);
+		*node = avl_rotate_right(*node, augment);
 	}
 	// Right Heavy
 	else if (balance < -1) {
 		// Determine if a right-left rotation is needed
 		if (avl_balance((*node)->right) > 0) {
-			(*node)->right = avl_rotate_right((*node)->right);
+			(*node)->right = avl_rotate_right((*node)->right, augment);
 		}
 		// Perform a left rotation
-		*node = avl_rotate_left(*node);
+		*node = avl_rotate_left(*node, augment);
 	}
 }
 
+/**
+ * Rebalances a node according to AVL rules.
+ * @param node - the node to process
+ */
+static void avl_rebalance(avl_node **node) {
+	avl_rebalance_augmented(node, NULL);
+	return;
+}
+
 /**
  * Inserts item into a AVL. Insertion must preserve the AVL definition.
  * Only one of item may be in the source.
@@ -196,15 +267,39 @@ static BOOLEAN avl_insert_aux(avl_linked *source, avl_node **node,
 		return FALSE;
 	}
 
-	// Update the height of the current node.
-	avl_update_height(*node);
-
-	// Rebalance the tree if necessary.
+	// Rebalance the tree if necessary - this also updates the node height.
 	avl_rebalance(node);
 
 	return TRUE;
 }
 
+/**
+ * Rebalances the nodes on a path from the bottom up. Stops as soon as a
+ * subtree keeps its height, since nothing above it can change.
+ * @param path - links from the root down to the changed subtree
+ * @param depth - number of links in path
+ */
+static void avl_retrace(avl_node ***path, int depth) {
+	BOOLEAN changed = TRUE;
+
+	while (depth > 0 && changed) {
+		depth--;
+		avl_node **link = path[depth];
+		int height = (*link)->height;
+		// avl_rebalance updates the height once before deciding to rotate.
+		avl_rebalance(link);
+		changed = ((*link)->height != height);
+	}
+#ifdef AVL_MERKLE
+	// The heights above are settled, but not the subtree hashes.
+	while (depth > 0) {
+		depth--;
+		avl_update_hash(*path[depth]);
+	}
+#endif
+	return;
+}
+
 /**
  * Attempts to find a item matching key in a AVL node. Deletes the node
  * if found.
@@ -216,41 +311,44 @@ static BOOLEAN avl_insert_aux(avl_linked *source, avl_node **node,
  */
 static BOOLEAN avl_remove_aux(avl_linked *source, avl_node **node,
 		const data_ptr key, data_ptr item) {
-	if (*node == NULL) {
-		return FALSE;
-	}
-	int cmp = data_compare(key, (*node)->item);
-	if (cmp < 0) {
-		avl_remove_aux(source, &(*node)->left, key, item);
-	} else if (cmp > 0) {
-		avl_remove_aux(source, &(*node)->right, key, item);
-	} else {
-		if (((*node)->left == NULL) || ((*node)->right) == NULL) {
-			avl_node *temp = (*node)->left ? (*node)->left : (*node)->right;
-			if (temp == NULL) {
-				temp = (*node);
-				(*node) = NULL;
-			} else {
-				(**node) = *temp;
-			}
-			free(temp);
+	BOOLEAN removed = FALSE;
+
+	if (*node != NULL) {
+		int cmp = data_compare(key, (*node)->item);
+
+		if (cmp < 0) {
+			removed = avl_remove_aux(source, &(*node)->left, key, item);
+		} else if (cmp > 0) {
+			removed = avl_remove_aux(source, &(*node)->right, key, item);
 		} else {
-			avl_node *temp = (*node)->right;
-			while (temp->left != NULL) {
-				temp = temp->left;
+			data_copy(item, (*node)->item);
+
+			if (((*node)->left == NULL) || ((*node)->right) == NULL) {
+				avl_node *temp = *node;
+				*node = temp->left ? temp->left : temp->right;
+				data_free(&temp->item);
+				free(temp);
+				source->count--;
+			} else {
+				// Copy the successor into the node and remove the successor.
+				avl_node *temp = (*node)->right;
+				data_value successor;
+
+				while (temp->left != NULL) {
+					temp = temp->left;
+				}
+				data_copy((*node)->item, temp->item);
+				avl_remove_aux(source, &(*node)->right, (*node)->item,
+						&successor);
 			}
-			(*node)->item = temp->item;
-			avl_remove_aux(source, &(*node)->right, temp->item, item);
+			removed = TRUE;
+		}
+		if (removed && *node != NULL) {
+			// Rebalance the tree if necessary - this also updates the height.
+			avl_rebalance(node);
 		}
-		source->count--;
-		return TRUE;
 	}
-	// Update the height of the current node.
-	avl_update_height(*node);
-
-	// Rebalance the tree if necessary.
-	avl_rebalance(node);
-	return TRUE;
+	return removed;
 }
 
 /**
@@ -345,6 +443,7 @@ static AVL_ERROR avl_valid_aux(const avl_node *node) {
 	return (valid);
 }
 
+#ifndef AVL_MERKLE
 /**
  * Determines if two AVL subtrees are equal.
  *
@@ -368,6 +467,132 @@ static BOOLEAN avl_equals_aux(const avl_node *target_node,
 	}
 	return equals;
 }
+#endif
+
+/**
+ * In-order iterator over an AVL subtree - the stack holds the nodes whose
+ * items and right subtrees are still to be visited.
+ */
+typedef struct {
+	const avl_node *stack[AVL_MAX_HEIGHT];
+	int depth;
+} avl_iterator;
+
+/**
+ * Pushes node and its chain of left descendants onto an iterator.
+ *
+ * @param iterator - pointer to an iterator
+ * @param node - pointer to an AVL node
+ */
+static void avl_iterator_push(avl_iterator *iterator, const avl_node *node) {
+
+	while (node != NULL) {
+		iterator->stack[iterator->depth] = node;
+		iterator->depth++;
+		node = node->left;
+	}
+	return;
+}
+
+/**
+ * Returns the next node of an iterator in inorder.
+ *
+ * @param iterator - pointer to an iterator
+ * @return - pointer to the next node, NULL if there are no more nodes
+ */
+static const avl_node* avl_iterator_next(avl_iterator *iterator) {
+	const avl_node *node = NULL;
+
+	if (iterator->depth > 0) {
+		iterator->depth--;
+		node = iterator->stack[iterator->depth];
+		avl_iterator_push(iterator, node->right);
+	}
+	return node;
+}
+
+/**
+ * Reports the differences between two subtrees that cover the same key
+ * range by merging them in order.
+ *
+ * @param target_node - pointer to an AVL node
+ * @param source_node - pointer to an AVL node
+ * @param report - function called for each differing item
+ * @param context - pointer passed to report
+ * @return - number of differing items
+ */
+static int avl_diff_merge(const avl_node *target_node,
+		const avl_node *source_node, avl_diff_callback report, void *context) {
+	avl_iterator target;
+	avl_iterator source;
+	int differences = 0;
+
+	target.depth = 0;
+	source.depth = 0;
+	avl_iterator_push(&target, target_node);
+	avl_iterator_push(&source, source_node);
+	target_node = avl_iterator_next(&target);
+	source_node = avl_iterator_next(&source);
+
+	while (target_node != NULL || source_node != NULL) {
+		int comp = 0;
+
+		if (target_node == NULL) {
+			comp = 1;
+		} else if (source_node == NULL) {
+			comp = -1;
+		} else {
+			comp = data_compare(target_node->item, source_node->item);
+		}
+		if (comp < 0) {
+			report(target_node->item, TRUE, context);
+			differences++;
+			target_node = avl_iterator_next(&target);
+		} else if (comp > 0) {
+			report(source_node->item, FALSE, context);
+			differences++;
+			source_node = avl_iterator_next(&source);
+		} else {
+			target_node = avl_iterator_next(&target);
+			source_node = avl_iterator_next(&source);
+		}
+	}
+	return differences;
+}
+
+/**
+ * Reports the differences between two subtrees that cover the same key
+ * range.
+ *
+ * @param target_node - pointer to an AVL node
+ * @param source_node - pointer to an AVL node
+ * @param report - function called for each differing item
+ * @param context - pointer passed to report
+ * @return - number of differing items
+ */
+static int avl_diff_aux(const avl_node *target_node,
+		const avl_node *source_node, avl_diff_callback report, void *context) {
+	int differences = 0;
+
+#ifdef AVL_MERKLE
+	if (avl_node_hash(target_node) == avl_node_hash(source_node)) {
+		// Identical subtrees (or both empty).
+		return 0;
+	}
+#endif
+	if (target_node != NULL && source_node != NULL
+			&& data_compare(target_node->item, source_node->item) == 0) {
+		// Same root item: the children cover the same key ranges.
+		differences = avl_diff_aux(target_node->left, source_node->left,
+				report, context)
+				+ avl_diff_aux(target_node->right, source_node->right, report,
+						context);
+	} else if (target_node != NULL || source_node != NULL) {
+		differences = avl_diff_merge(target_node, source_node, report,
+				context);
+	}
+	return differences;
+}
 
 /**
  * Private helper function to print contents of an AVL in preorder.
@@ -438,6 +663,28 @@ BOOLEAN avl_insert(avl_linked *source, data_ptr item) {
 	return (avl_insert_aux(source, &(source->root), item));
 }
 
+BOOLEAN avl_insert_iterative(avl_linked *source, const data_ptr item) {
+	avl_node **path[AVL_MAX_HEIGHT];
+	avl_node **link = &source->root;
+	int depth = 0;
+
+	while (*link != NULL) {
+		int comp = data_compare(item, (*link)->item);
+
+		if (comp == 0) {
+			// Duplicate item found, do not insert.
+			return FALSE;
+		}
+		path[depth] = link;
+		depth++;
+		link = (comp < 0) ? &(*link)->left : &(*link)->right;
+	}
+	*link = avl_node_initialize(item);
+	source->count++;
+	avl_retrace(path, depth);
+	return TRUE;
+}
+
 BOOLEAN avl_retrieve(const avl_linked *source, data_ptr key, data_ptr item) {
 	BOOLEAN retrieved = FALSE;
 	avl_node *node = source->root;
@@ -457,16 +704,134 @@ BOOLEAN avl_retrieve(const avl_linked *source, data_ptr key, data_ptr item) {
 	return retrieved;
 }
 
+int avl_retrieve_many(const avl_linked *source, data_ptr *keys, int count,
+		data_ptr *items, BOOLEAN *found) {
+	const avl_node *nodes[AVL_RETRIEVE_GROUP]; // current node of each search
+	int searches[AVL_RETRIEVE_GROUP];          // key index of each search
+	int active = 0;
+	int next = 0;
+	int retrieved = 0;
+
+	while (active < AVL_RETRIEVE_GROUP && next < count) {
+		nodes[active] = source->root;
+		searches[active] = next;
+		active++;
+		next++;
+	}
+	while (active > 0) {
+		// The nodes were prefetched last round: start loading their items.
+		for (int i = 0; i < active; i++) {
+			if (nodes[i] != NULL) {
+				AVL_PREFETCH(nodes[i]->item);
+			}
+		}
+		int i = 0;
+
+		while (i < active) {
+			const avl_node *node = nodes[i];
+			int k = searches[i];
+			BOOLEAN done = TRUE;
+
+			if (node == NULL) {
+				found[k] = FALSE;
+			} else {
+				int comp = data_compare(keys[k], node->item);
+
+				if (comp == 0) {
+					data_copy(items[k], node->item);
+					found[k] = TRUE;
+					retrieved++;
+				} else {
+					node = (comp < 0) ? node->left : node->right;
+
+					if (node != NULL) {
+						AVL_PREFETCH(node);
+					}
+					nodes[i] = node;
+					done = FALSE;
+				}
+			}
+			if (!done) {
+				i++;
+			} else if (next < count) {
+				// Start the next search in the finished search's place.
+				nodes[i] = source->root;
+				searches[i] = next;
+				next++;
+				i++;
+			} else {
+				active--;
+				nodes[i] = nodes[active];
+				searches[i] = searches[active];
+			}
+		}
+	}
+	return retrieved;
+}
+
 BOOLEAN avl_remove(avl_linked *source, const data_ptr key, data_ptr item) {
 	return (avl_remove_aux(source, &(source->root), key, item));
 }
 
+BOOLEAN avl_remove_iterative(avl_linked *source, const data_ptr key,
+		data_ptr item) {
+	avl_node **path[AVL_MAX_HEIGHT];
+	avl_node **link = &source->root;
+	int depth = 0;
+	int comp = 1;
+
+	while (*link != NULL && (comp = data_compare(key, (*link)->item)) != 0) {
+		path[depth] = link;
+		depth++;
+		link = (comp < 0) ? &(*link)->left : &(*link)->right;
+	}
+	if (*link == NULL) {
+		return FALSE;
+	}
+	avl_node *node = *link;
+	data_copy(item, node->item);
+
+	if (node->left != NULL && node->right != NULL) {
+		// Move the successor's item into node and remove the successor instead.
+		path[depth] = link;
+		depth++;
+		link = &node->right;
+
+		while ((*link)->left != NULL) {
+			path[depth] = link;
+			depth++;
+			link = &(*link)->left;
+		}
+		data_ptr temp = node->item;
+		node->item = (*link)->item;
+		(*link)->item = temp;
+		node = *link;
+	}
+	*link = (node->left != NULL) ? node->left : node->right;
+	data_free(&node->item);
+	free(node);
+	source->count--;
+	avl_retrace(path, depth);
+	return TRUE;
+}
+
 AVL_ERROR avl_valid(const avl_linked *source) {
 	return (avl_valid_aux(source->root));
 }
 
 BOOLEAN avl_equals(const avl_linked *target, const avl_linked *source) {
+#ifdef AVL_MERKLE
+	// Equal 64-bit hashes of different trees are vanishingly unlikely.
+	return (target->count == source->count
+			&& avl_node_hash(target->root) == avl_node_hash(source->root));
+#else
 	return (avl_equals_aux(target->root, source->root));
+#endif
+}
+
+int avl_diff(const avl_linked *target, const avl_linked *source,
+		avl_diff_callback report, void *context) {
+	return (avl_diff_aux(target->root, source->root, report, context));
 }
 
 // Returns a string version of an AVL error.
@@ -496,3 +861,13 @@ void avl_print(const avl_linked *source) {
 	printf("\n");
 	return;
 }
+
+void avl_node_rebalance(avl_node **node) {
+	avl_rebalance(node);
+	return;
+}
+
+void avl_node_rebalance_augmented(avl_node **node, avl_augment augment) {
+	avl_rebalance_augmented(node, augment);
+	return;
+}
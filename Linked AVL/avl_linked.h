@@ -18,6 +18,13 @@
 
 #include "data.h"
 
+#define AVL_RETRIEVE_GROUP 16 // Searches advanced together by avl_retrieve_many
+#define AVL_MAX_HEIGHT 64     // Path length bound: enough for any int count
+
+// Define AVL_MERKLE for every file (e.g. -DAVL_MERKLE) to keep a hash of
+// every subtree: avl_equals then compares root hashes in O(1) and avl_diff
+// skips subtrees that are identical.
+
 // typedefs
 /**
  * AVL validation enum
@@ -37,10 +44,32 @@ typedef enum AVL_ERROR {
 typedef struct AVL_NODE {
     data_ptr item;           // Pointer to the node data.
     int height;              // Height of the current node.
+#ifdef AVL_MERKLE
+    unsigned long long hash; // Hash of items, heights and shape of the subtree.
+#endif
     struct AVL_NODE *left;   // Pointer to the left child.
     struct AVL_NODE *right;  // Pointer to the right child.
 } avl_node;
 
+/**
+ * Function called by avl_diff for each item found in only one AVL.
+ *
+ * item - pointer to the item
+ * in_target - TRUE if the item is only in target, FALSE if only in source
+ * context - pointer passed to avl_diff
+ */
+typedef void (*avl_diff_callback)(data_ptr item, BOOLEAN in_target,
+        void *context);
+
+/**
+ * Function that recomputes data a derived tree keeps in its nodes from
+ * the node and its children, e.g. the largest endpoint in an interval
+ * tree. Called bottom-up whenever a node or its children change.
+ *
+ * node - pointer to the node to update
+ */
+typedef void (*avl_augment)(avl_node *node);
+
 /**
  * AVL header
  */
@@ -98,6 +127,16 @@ int avl_count(const avl_linked *source);
  */
 BOOLEAN avl_insert(avl_linked *source, const data_ptr item);
 
+/**
+ * Inserts a copy of an item into a AVL without recursion. Heights are
+ * retraced from the new leaf only until a subtree height is unchanged.
+ *
+ * @param source - pointer to a AVL
+ * @param item - pointer to the item to insert
+ * @return - TRUE if item inserted, FALSE otherwise
+ */
+BOOLEAN avl_insert_iterative(avl_linked *source, const data_ptr item);
+
 /**
  * Retrieves a copy of a value matching key in a AVL.
  *
@@ -108,6 +147,21 @@ BOOLEAN avl_insert(avl_linked *source, const data_ptr item);
  */
 BOOLEAN avl_retrieve(const avl_linked *source, data_ptr key, data_ptr item);
 
+/**
+ * Retrieves copies of the values matching an array of keys. Up to
+ * AVL_RETRIEVE_GROUP searches advance one level at a time together, and
+ * each prefetches its next node and item so their cache misses overlap.
+ *
+ * @param source - pointer to a AVL
+ * @param keys - array of keys to search for
+ * @param count - number of keys
+ * @param items - array of pointers to copies of the items retrieved
+ * @param found - set to TRUE for each key retrieved, FALSE otherwise
+ * @return - number of keys retrieved
+ */
+int avl_retrieve_many(const avl_linked *source, data_ptr *keys, int count,
+        data_ptr *items, BOOLEAN *found);
+
 /**
  * Removes a value matching key in a AVL.
  *
@@ -118,6 +172,18 @@ BOOLEAN avl_retrieve(const avl_linked *source, data_ptr key, data_ptr item);
  */
 BOOLEAN avl_remove(avl_linked *source, const data_ptr key, data_ptr item);
 
+/**
+ * Removes a value matching key in a AVL without recursion. Heights are
+ * retraced from the removed node only until a subtree height is unchanged.
+ *
+ * @param source - pointer to a AVL
+ * @param key - key value to search for
+ * @param item - pointer to copy of the item removed
+ * @return - TRUE if item removed, FALSE otherwise (key not found)
+ */
+BOOLEAN avl_remove_iterative(avl_linked *source, const data_ptr key,
+        data_ptr item);
+
 /**
  * Copies the contents of a AVL to an array in inorder.
  *
@@ -152,6 +218,7 @@ AVL_ERROR avl_valid(const avl_linked *source);
 
 /**
  * Determines if two trees contain same data in same configuration.
+ * With AVL_MERKLE this compares the root hashes in O(1).
  *
  * @param target - pointer to a AVL
  * @param source - pointer to a AVL
@@ -159,6 +226,21 @@ AVL_ERROR avl_valid(const avl_linked *source);
  */
 BOOLEAN avl_equals(const avl_linked *target, const avl_linked *source);
 
+/**
+ * Reports the items that are in only one of two AVLs, in order within
+ * each subtree. Subtrees at the same position with the same root item are
+ * compared child by child; with AVL_MERKLE, subtrees with equal hashes
+ * are skipped. Where the shapes differ the subtrees are merged in order.
+ *
+ * @param target - pointer to a AVL
+ * @param source - pointer to a AVL
+ * @param report - function called for each differing item
+ * @param context - pointer passed to report
+ * @return - number of differing items
+ */
+int avl_diff(const avl_linked *target, const avl_linked *source,
+        avl_diff_callback report, void *context);
+
 /**
  * Returns a string version of an AVL error.
  *
@@ -176,4 +258,21 @@ char* avl_error_string(char *string, size_t size, AVL_ERROR error);
  */
 void avl_print(const avl_linked *source);
 
+/**
+ * Updates the height of a node and rotates it if it is out of balance.
+ * For containers that link their own nodes through an avl_node.
+ *
+ * @param node - link to the node to process
+ */
+void avl_node_rebalance(avl_node **node);
+
+/**
+ * Updates the height and augmented data of a node and rotates it if it is
+ * out of balance. Rotated nodes are augmented again in their new places.
+ *
+ * @param node - link to the node to process
+ * @param augment - function that updates the node data of a derived tree
+ */
+void avl_node_rebalance_augmented(avl_node **node, avl_augment augment);
+
 #endif /* AVL_LINKED_H_ */
@@ -0,0 +1,256 @@
+/**
+ * -------------------------------------
+ * @file  avl_map.c
+ * AVL Map Source Code File
+ * -------------------------------------
+ * @author Filip Stanojcic
+ *
+ * @version 2026-10-18
+ *
+ */
+// Includes
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "avl_map.h"
+
+// Local Functions
+
+/**
+ * Allocates a map entry holding a copy of key and a zero-filled value.
+ *
+ * @param source - pointer to an AVL map
+ * @param key - pointer to the key to assign to the entry
+ * @return a pointer to a new map entry
+ */
+static avl_map_entry* avl_map_entry_initialize(const avl_map *source,
+		const data_ptr key) {
+	avl_map_entry *entry = malloc(sizeof *entry + source->value_size);
+	data_copy(&entry->key, key);
+	memset(entry->value, 0, source->value_size);
+	entry->node.item = &entry->key;
+	entry->node.height = 1;
+	entry->node.left = NULL;
+	entry->node.right = NULL;
+	avl_node *node = &entry->node;
+	// Sets the hash under AVL_MERKLE.
+	avl_node_rebalance(&node);
+	return entry;
+}
+
+/**
+ * Frees a node and its children.
+ * @param node - The node to process
+ */
+static void avl_map_free_aux(avl_node *node) {
+
+	if (node != NULL) {
+		avl_map_free_aux(node->left);
+		avl_map_free_aux(node->right);
+		free(node);
+	}
+	return;
+}
+
+/**
+ * Finds the entry for key below node, adding an entry if there is none.
+ * @param source - pointer to an AVL map
+ * @param node - The node to process.
+ * @param key - The key to look for.
+ * @param inserted - set to TRUE if a new entry is added
+ * @return the entry for key
+ */
+static avl_map_entry* avl_map_find_aux(avl_map *source, avl_node **node,
+		const data_ptr key, BOOLEAN *inserted) {
+	avl_map_entry *entry = NULL;
+
+	if (*node == NULL) {
+		entry = avl_map_entry_initialize(source, key);
+		*node = &entry->node;
+		source->count++;
+		*inserted = TRUE;
+	} else {
+		int comp = data_compare(key, (*node)->item);
+
+		if (comp < 0) {
+			entry = avl_map_find_aux(source, &(*node)->left, key, inserted);
+		} else if (comp > 0) {
+			entry = avl_map_find_aux(source, &(*node)->right, key, inserted);
+		} else {
+			entry = (avl_map_entry*) *node;
+		}
+		if (*inserted) {
+			// Rebalance the tree if necessary - this also updates the height.
+			avl_node_rebalance(node);
+		}
+	}
+	return entry;
+}
+
+/**
+ * Unlinks the leftmost node below node.
+ * @param node - The node to process, must not be empty.
+ * @return the unlinked node
+ */
+static avl_node* avl_map_remove_min(avl_node **node) {
+	avl_node *min = NULL;
+
+	if ((*node)->left == NULL) {
+		min = *node;
+		*node = min->right;
+	} else {
+		min = avl_map_remove_min(&(*node)->left);
+		avl_node_rebalance(node);
+	}
+	return min;
+}
+
+/**
+ * Attempts to find key below node. Unlinks and frees its entry if found.
+ * @param source - pointer to an AVL map
+ * @param node - The node to process.
+ * @param key - The key to look for.
+ * @param value - if not NULL, copy of the value removed
+ * @return TRUE if the key is found and the entry removed, FALSE otherwise.
+ */
+static BOOLEAN avl_map_remove_aux(avl_map *source, avl_node **node,
+		const data_ptr key, void *value) {
+	BOOLEAN removed = FALSE;
+
+	if (*node != NULL) {
+		int comp = data_compare(key, (*node)->item);
+
+		if (comp < 0) {
+			removed = avl_map_remove_aux(source, &(*node)->left, key, value);
+		} else if (comp > 0) {
+			removed = avl_map_remove_aux(source, &(*node)->right, key, value);
+		} else {
+			avl_map_entry *entry = (avl_map_entry*) *node;
+
+			if (value != NULL) {
+				memcpy(value, entry->value, source->value_size);
+			}
+			if (entry->node.left == NULL || entry->node.right == NULL) {
+				*node = entry->node.left ?
+						entry->node.left : entry->node.right;
+			} else {
+				// Relink the successor entry in place of the removed one.
+				avl_node *successor = avl_map_remove_min(&entry->node.right);
+				successor->left = entry->node.left;
+				successor->right = entry->node.right;
+				*node = successor;
+			}
+			free(entry);
+			source->count--;
+			removed = TRUE;
+		}
+		if (removed && *node != NULL) {
+			// Rebalance the tree if necessary - this also updates the height.
+			avl_node_rebalance(node);
+		}
+	}
+	return removed;
+}
+
+/**
+ * Copies the keys and values below node to array locations.
+ *
+ * @param node - The node to process
+ * @param keys - array of keys
+ * @param values - array of value pointers
+ * @param index - current index in arrays
+ * @return - the updated index
+ */
+static int avl_map_inorder_aux(const avl_node *node, data_ptr *keys,
+		void **values, int index) {
+
+	if (node != NULL) {
+		index = avl_map_inorder_aux(node->left, keys, values, index);
+		keys[index] = node->item;
+		values[index] = ((avl_map_entry*) node)->value;
+		index++;
+		index = avl_map_inorder_aux(node->right, keys, values, index);
+	}
+	return index;
+}
+
+//--------------------------------------------------------------------
+// Functions
+
+avl_map* avl_map_initialize(size_t value_size) {
+	avl_map *source = malloc(sizeof *source);
+	source->count = 0;
+	source->value_size = value_size;
+	source->root = NULL;
+	return source;
+}
+
+void avl_map_free(avl_map **source) {
+	avl_map_free_aux((*source)->root);
+	free(*source);
+	*source = NULL;
+	return;
+}
+
+int avl_map_count(const avl_map *source) {
+	return source->count;
+}
+
+BOOLEAN avl_map_upsert(avl_map *source, const data_ptr key,
+		const void *value) {
+	BOOLEAN inserted = FALSE;
+	avl_map_entry *entry = avl_map_find_aux(source, &source->root, key,
+			&inserted);
+
+	memcpy(entry->value, value, source->value_size);
+	return inserted;
+}
+
+void* avl_map_get_ref(const avl_map *source, const data_ptr key) {
+	void *value = NULL;
+	const avl_node *node = source->root;
+
+	while (node != NULL && value == NULL) {
+		int comp = data_compare(key, node->item);
+
+		if (comp < 0) {
+			node = node->left;
+		} else if (comp > 0) {
+			node = node->right;
+		} else {
+			value = ((avl_map_entry*) node)->value;
+		}
+	}
+	return value;
+}
+
+BOOLEAN avl_map_retrieve(const avl_map *source, const data_ptr key,
+		void *value) {
+	const void *stored = avl_map_get_ref(source, key);
+
+	if (stored != NULL) {
+		memcpy(value, stored, source->value_size);
+	}
+	return (stored != NULL);
+}
+
+BOOLEAN avl_map_update(avl_map *source, const data_ptr key,
+		avl_map_update_fn update, void *context) {
+	BOOLEAN inserted = FALSE;
+	avl_map_entry *entry = avl_map_find_aux(source, &source->root, key,
+			&inserted);
+
+	update(entry->value, inserted, context);
+	return inserted;
+}
+
+BOOLEAN avl_map_remove(avl_map *source, const data_ptr key, void *value) {
+	return (avl_map_remove_aux(source, &source->root, key, value));
+}
+
+// Copies the keys and value pointers of an AVL map to arrays in key order.
+void avl_map_inorder(const avl_map *source, data_ptr *keys, void **values) {
+	avl_map_inorder_aux(source->root, keys, values, 0);
+	return;
+}
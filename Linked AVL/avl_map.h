@@ -0,0 +1,145 @@
+/**
+ * -------------------------------------
+ * @file  avl_map.h
+ * AVL Map Header File
+ * -------------------------------------
+ * @author Filip Stanojcic
+ *
+ * @version 2026-10-18
+ *
+ * An AVL that maps keys to fixed-size values. Each entry is one
+ * allocation holding the AVL node, the key and the value, and entries are
+ * relinked rather than copied when the tree changes, so a pointer to a
+ * value stays valid until its key is removed.
+ */
+#ifndef AVL_MAP_H_
+#define AVL_MAP_H_
+
+// Includes
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+
+#include "data.h"
+#include "avl_linked.h"
+
+// typedefs
+/**
+ * AVL map entry
+ */
+typedef struct {
+    avl_node node;           // AVL links: node.item points to key.
+    data_value key;          // The entry key.
+    _Alignas(max_align_t) unsigned char value[]; // The entry value.
+} avl_map_entry;
+
+/**
+ * AVL map header
+ */
+typedef struct {
+    int count;               // Number of entries in the map.
+    size_t value_size;       // Size of one value in bytes.
+    avl_node *root;          // Pointer to root node of the map.
+} avl_map;
+
+/**
+ * Function called by avl_map_update with the value stored for a key.
+ *
+ * value - pointer to the stored value, zero-filled if the key is new
+ * inserted - TRUE if the key was added by this update
+ * context - pointer passed to avl_map_update
+ */
+typedef void (*avl_map_update_fn)(void *value, BOOLEAN inserted,
+        void *context);
+
+// Prototypes
+
+/**
+ * Initializes an AVL map.
+ *
+ * @param value_size - size of one value in bytes
+ * @return pointer to an AVL map
+ */
+avl_map* avl_map_initialize(size_t value_size);
+
+/**
+ * Frees all parts of an AVL map.
+ *
+ * @param source - pointer to an AVL map
+ */
+void avl_map_free(avl_map **source);
+
+/**
+ * Returns number of entries in an AVL map.
+ *
+ * @param source - pointer to an AVL map
+ * @return - number of entries in the map
+ */
+int avl_map_count(const avl_map *source);
+
+/**
+ * Stores a copy of value under key in one descent, adding the key if it
+ * is not in the map and overwriting its value otherwise.
+ *
+ * @param source - pointer to an AVL map
+ * @param key - key to store value under
+ * @param value - pointer to the value to copy
+ * @return - TRUE if key was added, FALSE if its value was replaced
+ */
+BOOLEAN avl_map_upsert(avl_map *source, const data_ptr key,
+        const void *value);
+
+/**
+ * Returns a pointer to the value stored under key. Nothing is copied, and
+ * the value may be changed in place.
+ *
+ * @param source - pointer to an AVL map
+ * @param key - key value to search for
+ * @return - pointer to the stored value, NULL if key is not found
+ */
+void* avl_map_get_ref(const avl_map *source, const data_ptr key);
+
+/**
+ * Retrieves a copy of the value stored under key.
+ *
+ * @param source - pointer to an AVL map
+ * @param key - key value to search for
+ * @param value - pointer to copy of the value retrieved
+ * @return - TRUE if value retrieved, FALSE otherwise (key not found)
+ */
+BOOLEAN avl_map_retrieve(const avl_map *source, const data_ptr key,
+        void *value);
+
+/**
+ * Calls update on the value stored under key in one descent, first adding
+ * the key with a zero-filled value if it is not in the map.
+ *
+ * @param source - pointer to an AVL map
+ * @param key - key of the value to update
+ * @param update - function that changes the value in place
+ * @param context - pointer passed to update
+ * @return - TRUE if key was added, FALSE otherwise
+ */
+BOOLEAN avl_map_update(avl_map *source, const data_ptr key,
+        avl_map_update_fn update, void *context);
+
+/**
+ * Removes key and its value from an AVL map.
+ *
+ * @param source - pointer to an AVL map
+ * @param key - key value to search for
+ * @param value - if not NULL, pointer to copy of the value removed
+ * @return - TRUE if key removed, FALSE otherwise (key not found)
+ */
+BOOLEAN avl_map_remove(avl_map *source, const data_ptr key, void *value);
+
+/**
+ * Copies the keys and value pointers of an AVL map to arrays in key order.
+ *
+ * @param source - pointer to an AVL map
+ * @param keys - array of keys: length must be at least size of map
+ * @param values - array of value pointers: length must be at least size of map
+ */
+void avl_map_inorder(const avl_map *source, data_ptr *keys, void **values);
+
+#endif /* AVL_MAP_H_ */
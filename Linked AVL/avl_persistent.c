@@ -0,0 +1,444 @@
+/**
+ * -------------------------------------
+ * @file  avl_persistent.c
+ * Persistent (Path-Copying) AVL Source Code File
+ * -------------------------------------
+ * @author Filip Stanojcic
+ *
+ * @version 2026-10-18
+ *
+ */
+// Includes
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "avl_persistent.h"
+
+// Local Functions
+
+/**
+ * Initializes a new node with a copy of item. The node belongs to the
+ * current write.
+ *
+ * @param source - pointer to a persistent AVL
+ * @param item - pointer to the item to assign to the node
+ * @return a pointer to a new node
+ */
+static avl_pnode* avl_pnode_initialize(const avl_persistent *source,
+		const data_ptr item) {
+	avl_pnode *node = malloc(sizeof *node);
+	node->item = malloc(sizeof *node->item);
+	data_copy(node->item, item);
+	node->height = 1;
+	atomic_init(&node->refs, 1);
+	node->stamp = source->stamp;
+	node->left = NULL;
+	node->right = NULL;
+	return node;
+}
+
+/**
+ * Adds a reference to a node - handles empty node.
+ *
+ * @param node - the node to process
+ */
+static void avl_pnode_retain(avl_pnode *node) {
+
+	if (node != NULL) {
+		atomic_fetch_add(&node->refs, 1);
+	}
+	return;
+}
+
+/**
+ * Drops a reference to a node. Frees the node and drops its references to
+ * its children when no version or parent reaches it any more.
+ *
+ * @param node - the node to process
+ */
+static void avl_pnode_release(avl_pnode *node) {
+
+	if (node != NULL && atomic_fetch_sub(&node->refs, 1) == 1) {
+		avl_pnode_release(node->left);
+		avl_pnode_release(node->right);
+		data_free(&node->item);
+		free(node);
+	}
+	return;
+}
+
+/**
+ * Returns a node that may be modified by the current write. Nodes created
+ * by the current write are returned as is, published nodes are copied.
+ * The caller's reference to node is transferred to the returned node.
+ *
+ * @param source - pointer to a persistent AVL
+ * @param node - the node to process
+ * @return pointer to a node owned by the current write
+ */
+static avl_pnode* avl_pnode_own(const avl_persistent *source, avl_pnode *node) {
+
+	if (node->stamp != source->stamp) {
+		avl_pnode *copy = avl_pnode_initialize(source, node->item);
+		copy->height = node->height;
+		copy->left = node->left;
+		copy->right = node->right;
+		avl_pnode_retain(copy->left);
+		avl_pnode_retain(copy->right);
+		avl_pnode_release(node);
+		node = copy;
+	}
+	return node;
+}
+
+/**
+ * Helper function to determine the height of node - handles empty node.
+ * @param node - The node to process.
+ * @return The height of the current node.
+ */
+static int avl_pnode_height(const avl_pnode *node) {
+	int height = 0;
+
+	if (node != NULL) {
+		height = node->height;
+	}
+	return (height);
+}
+
+/**
+ * Updates the height of a node. Its height is the max of the heights of its
+ * child nodes, plus 1.
+ * @param node - The node to process.
+ */
+static void avl_pnode_update_height(avl_pnode *node) {
+	int left_height = avl_pnode_height(node->left);
+	int right_height = avl_pnode_height(node->right);
+
+	if (left_height >= right_height) {
+		node->height = left_height + 1;
+	} else {
+		node->height = right_height + 1;
+	}
+	return;
+}
+
+/**
+ * Returns the balance of a node.
+ * @param node - The node to process.
+ * @return height of left child less height of right child
+ */
+static int avl_pnode_balance(const avl_pnode *node) {
+	return (avl_pnode_height(node->left) - avl_pnode_height(node->right));
+}
+
+/**
+ * Performs a left rotation around an owned node.
+ * @param source - pointer to a persistent AVL
+ * @param node - the node to process
+ * @return Pointer to new root of subtree
+ */
+static avl_pnode* avl_pnode_rotate_left(const avl_persistent *source,
+		avl_pnode *node) {
+	avl_pnode *newRoot = avl_pnode_own(source, node->right);
+	node->right = newRoot->left;
+	newRoot->left = node;
+
+	// Update heights
+	avl_pnode_update_height(node);
+	avl_pnode_update_height(newRoot);
+
+	return newRoot;
+}
+
+/**
+ * Performs a right rotation around an owned node.
+ * @param source - pointer to a persistent AVL
+ * @param node - the node to process
+ * @return Pointer to new root of subtree
+ */
+static avl_pnode* avl_pnode_rotate_right(const avl_persistent *source,
+		avl_pnode *node) {
+	avl_pnode *newRoot = avl_pnode_own(source, node->left);
+	node->left = newRoot->right;
+	newRoot->right = node;
+
+	// Update heights
+	avl_pnode_update_height(node);
+	avl_pnode_update_height(newRoot);
+
+	return newRoot;
+}
+
+/**
+ * Rebalances an owned node according to AVL rules. Any published node
+ * moved by a rotation is copied first.
+ * @param source - pointer to a persistent AVL
+ * @param node - the node to process
+ */
+static void avl_pnode_rebalance(const avl_persistent *source,
+		avl_pnode **node) {
+	avl_pnode_update_height(*node);
+	int balance = avl_pnode_balance(*node);
+
+	// Left Heavy
+	if (balance > 1) {
+		if (avl_pnode_balance((*node)->left) < 0) {
+			(*node)->left = avl_pnode_own(source, (*node)->left);
+			(*node)->left = avl_pnode_rotate_left(source, (*node)->left);
+		}
+		*node = avl_pnode_rotate_right(source, *node);
+	}
+	// Right Heavy
+	else if (balance < -1) {
+		if (avl_pnode_balance((*node)->right) > 0) {
+			(*node)->right = avl_pnode_own(source, (*node)->right);
+			(*node)->right = avl_pnode_rotate_right(source, (*node)->right);
+		}
+		*node = avl_pnode_rotate_left(source, *node);
+	}
+	return;
+}
+
+/**
+ * Finds the node matching key.
+ * @param node - root of the subtree to search
+ * @param key - key value to search for
+ * @return pointer to the matching node, NULL if key not found
+ */
+static const avl_pnode* avl_pnode_find(const avl_pnode *node,
+		const data_ptr key) {
+
+	while (node != NULL) {
+		int comp = data_compare(key, node->item);
+
+		if (comp < 0) {
+			node = node->left;
+		} else if (comp > 0) {
+			node = node->right;
+		} else {
+			break;
+		}
+	}
+	return node;
+}
+
+/**
+ * Inserts item below node, copying every node on the path. item must not
+ * already be in the subtree.
+ * @param source - pointer to a persistent AVL
+ * @param node - the node to process
+ * @param item - the item to insert
+ */
+static void avl_pnode_insert_aux(const avl_persistent *source,
+		avl_pnode **node, const data_ptr item) {
+
+	if (*node == NULL) {
+		// Base case: add a new node containing a copy of item.
+		*node = avl_pnode_initialize(source, item);
+	} else {
+		*node = avl_pnode_own(source, *node);
+
+		if (data_compare(item, (*node)->item) < 0) {
+			avl_pnode_insert_aux(source, &(*node)->left, item);
+		} else {
+			avl_pnode_insert_aux(source, &(*node)->right, item);
+		}
+		avl_pnode_rebalance(source, node);
+	}
+	return;
+}
+
+/**
+ * Removes the node matching key below node, copying every node on the
+ * path. key must be in the subtree.
+ * @param source - pointer to a persistent AVL
+ * @param node - the node to process
+ * @param key - the key to look for
+ * @param item - if not NULL, copy of the item removed
+ */
+static void avl_pnode_remove_aux(const avl_persistent *source,
+		avl_pnode **node, const data_ptr key, data_ptr item) {
+	int comp = data_compare(key, (*node)->item);
+
+	if (comp == 0 && ((*node)->left == NULL || (*node)->right == NULL)) {
+		// Base case: replace node by its only child - nothing to copy.
+		avl_pnode *child = (*node)->left ? (*node)->left : (*node)->right;
+
+		if (item != NULL) {
+			data_copy(item, (*node)->item);
+		}
+		avl_pnode_retain(child);
+		avl_pnode_release(*node);
+		*node = child;
+	} else {
+		*node = avl_pnode_own(source, *node);
+
+		if (comp < 0) {
+			avl_pnode_remove_aux(source, &(*node)->left, key, item);
+		} else if (comp > 0) {
+			avl_pnode_remove_aux(source, &(*node)->right, key, item);
+		} else {
+			// Replace the item with its successor and remove the successor.
+			const avl_pnode *successor = (*node)->right;
+
+			while (successor->left != NULL) {
+				successor = successor->left;
+			}
+			if (item != NULL) {
+				data_copy(item, (*node)->item);
+			}
+			data_copy((*node)->item, successor->item);
+			avl_pnode_remove_aux(source, &(*node)->right, (*node)->item, NULL);
+		}
+		avl_pnode_rebalance(source, node);
+	}
+	return;
+}
+
+/**
+ * Copies the contents of a node to an array location.
+ *
+ * @param items - array of items
+ * @param node - pointer to a node
+ * @param index - current index in array
+ * @return - the updated index
+ */
+static int avl_pnode_inorder_aux(data_ptr *items, const avl_pnode *node,
+		int index) {
+
+	if (node != NULL) {
+		index = avl_pnode_inorder_aux(items, node->left, index);
+		items[index] = node->item;
+		index++;
+		index = avl_pnode_inorder_aux(items, node->right, index);
+	}
+	return index;
+}
+
+/**
+ * Publishes a new version and releases the one it replaces.
+ * Must be called by the writer holding source->writer.
+ *
+ * @param source - pointer to a persistent AVL
+ * @param root - root of the new version
+ * @param count - number of items in the new version
+ */
+static void avl_persistent_publish(avl_persistent *source, avl_pnode *root,
+		int count) {
+	avl_version *version = malloc(sizeof *version);
+	atomic_init(&version->refs, 1);
+	version->count = count;
+	version->root = root;
+
+	pthread_mutex_lock(&source->publish);
+	avl_version *old = source->current;
+	source->current = version;
+	pthread_mutex_unlock(&source->publish);
+
+	avl_version_release(&old);
+	return;
+}
+
+//--------------------------------------------------------------------
+// Functions
+
+avl_persistent* avl_persistent_initialize() {
+	avl_persistent *source = malloc(sizeof *source);
+	source->current = malloc(sizeof *source->current);
+	atomic_init(&source->current->refs, 1);
+	source->current->count = 0;
+	source->current->root = NULL;
+	source->stamp = 0;
+	pthread_mutex_init(&source->publish, NULL);
+	pthread_mutex_init(&source->writer, NULL);
+	return source;
+}
+
+void avl_persistent_free(avl_persistent **source) {
+	avl_version_release(&(*source)->current);
+	pthread_mutex_destroy(&(*source)->publish);
+	pthread_mutex_destroy(&(*source)->writer);
+	free(*source);
+	*source = NULL;
+	return;
+}
+
+BOOLEAN avl_persistent_insert(avl_persistent *source, const data_ptr item) {
+	BOOLEAN inserted = FALSE;
+
+	pthread_mutex_lock(&source->writer);
+	// Only writers replace current, so the writer can read it unlocked.
+	const avl_version *base = source->current;
+
+	if (avl_pnode_find(base->root, item) == NULL) {
+		avl_pnode *root = base->root;
+
+		source->stamp++;
+		avl_pnode_retain(root);
+		avl_pnode_insert_aux(source, &root, item);
+		avl_persistent_publish(source, root, base->count + 1);
+		inserted = TRUE;
+	}
+	pthread_mutex_unlock(&source->writer);
+	return inserted;
+}
+
+BOOLEAN avl_persistent_remove(avl_persistent *source, const data_ptr key,
+		data_ptr item) {
+	BOOLEAN removed = FALSE;
+
+	pthread_mutex_lock(&source->writer);
+	const avl_version *base = source->current;
+
+	if (avl_pnode_find(base->root, key) != NULL) {
+		avl_pnode *root = base->root;
+
+		source->stamp++;
+		avl_pnode_retain(root);
+		avl_pnode_remove_aux(source, &root, key, item);
+		avl_persistent_publish(source, root, base->count - 1);
+		removed = TRUE;
+	}
+	pthread_mutex_unlock(&source->writer);
+	return removed;
+}
+
+avl_version* avl_persistent_acquire(avl_persistent *source) {
+	pthread_mutex_lock(&source->publish);
+	avl_version *version = source->current;
+	atomic_fetch_add(&version->refs, 1);
+	pthread_mutex_unlock(&source->publish);
+	return version;
+}
+
+void avl_version_release(avl_version **version) {
+
+	if (atomic_fetch_sub(&(*version)->refs, 1) == 1) {
+		avl_pnode_release((*version)->root);
+		free(*version);
+	}
+	*version = NULL;
+	return;
+}
+
+int avl_version_count(const avl_version *version) {
+	return version->count;
+}
+
+BOOLEAN avl_version_retrieve(const avl_version *version, const data_ptr key,
+		data_ptr item) {
+	BOOLEAN retrieved = FALSE;
+	const avl_pnode *node = avl_pnode_find(version->root, key);
+
+	if (node != NULL) {
+		data_copy(item, node->item);
+		retrieved = TRUE;
+	}
+	return retrieved;
+}
+
+// Copies the contents of a version to an array in inorder.
+void avl_version_inorder(const avl_version *version, data_ptr *items) {
+	avl_pnode_inorder_aux(items, version->root, 0);
+	return;
+}
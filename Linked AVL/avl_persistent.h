@@ -0,0 +1,141 @@
+/**
+ * -------------------------------------
+ * @file  avl_persistent.h
+ * Persistent (Path-Copying) AVL Header File
+ * -------------------------------------
+ * @author Filip Stanojcic
+ *
+ * @version 2026-10-18
+ *
+ * Writers never modify a published node: insert and remove copy the path
+ * from the root to the changed leaf and publish the new root as a new
+ * version. Readers acquire a version and search it without locks; the
+ * version and every node it reaches stay valid until it is released.
+ * Nodes are shared between versions and reclaimed by reference count.
+ *
+ * Link with -pthread.
+ */
+#ifndef AVL_PERSISTENT_H_
+#define AVL_PERSISTENT_H_
+
+// Includes
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "data.h"
+
+// typedefs
+/**
+ * Persistent AVL node - shared by every version that reaches it.
+ */
+typedef struct AVL_PNODE {
+    data_ptr item;           // Pointer to the node data.
+    int height;              // Height of the current node.
+    atomic_int refs;         // Number of parents and versions referencing the node.
+    unsigned long stamp;     // Write that created the node.
+    struct AVL_PNODE *left;  // Pointer to the left child.
+    struct AVL_PNODE *right; // Pointer to the right child.
+} avl_pnode;
+
+/**
+ * Immutable snapshot of a persistent AVL.
+ */
+typedef struct {
+    atomic_int refs;         // Number of handles to the version.
+    int count;               // Number of nodes in the version.
+    avl_pnode *root;         // Pointer to root node of the version.
+} avl_version;
+
+/**
+ * Persistent AVL header
+ */
+typedef struct {
+    avl_version *current;    // Most recently published version.
+    unsigned long stamp;     // Stamp of the current write.
+    pthread_mutex_t publish; // Guards current while a handle is taken or replaced.
+    pthread_mutex_t writer;  // Serializes writers.
+} avl_persistent;
+
+// Prototypes
+
+/**
+ * Initializes a persistent AVL.
+ *
+ * @return pointer to a persistent AVL
+ */
+avl_persistent* avl_persistent_initialize();
+
+/**
+ * Frees a persistent AVL. Versions still held by readers remain valid
+ * until they are released.
+ *
+ * @param source - pointer to a persistent AVL
+ */
+void avl_persistent_free(avl_persistent **source);
+
+/**
+ * Inserts a copy of an item and publishes the result as a new version.
+ *
+ * @param source - pointer to a persistent AVL
+ * @param item - pointer to the item to insert
+ * @return - TRUE if item inserted, FALSE otherwise
+ */
+BOOLEAN avl_persistent_insert(avl_persistent *source, const data_ptr item);
+
+/**
+ * Removes a value matching key and publishes the result as a new version.
+ *
+ * @param source - pointer to a persistent AVL
+ * @param key - key value to search for
+ * @param item - pointer to copy of the item removed
+ * @return - TRUE if item removed, FALSE otherwise (key not found)
+ */
+BOOLEAN avl_persistent_remove(avl_persistent *source, const data_ptr key,
+        data_ptr item);
+
+/**
+ * Returns a handle to the current version. The handle must be released
+ * with avl_version_release.
+ *
+ * @param source - pointer to a persistent AVL
+ * @return - pointer to the current version
+ */
+avl_version* avl_persistent_acquire(avl_persistent *source);
+
+/**
+ * Releases a version handle.
+ *
+ * @param version - pointer to a version handle
+ */
+void avl_version_release(avl_version **version);
+
+/**
+ * Returns number of items in a version.
+ *
+ * @param version - pointer to a version
+ * @return - number of items in version
+ */
+int avl_version_count(const avl_version *version);
+
+/**
+ * Retrieves a copy of a value matching key in a version.
+ *
+ * @param version - pointer to a version
+ * @param key - key value to search for
+ * @param item - pointer to copy of the item retrieved
+ * @return - TRUE if item retrieved, FALSE otherwise (key not found)
+ */
+BOOLEAN avl_version_retrieve(const avl_version *version, const data_ptr key,
+        data_ptr item);
+
+/**
+ * Copies the contents of a version to an array in inorder.
+ *
+ * @param version - pointer to a version
+ * @param items - array of items: length must be at least size of version
+ */
+void avl_version_inorder(const avl_version *version, data_ptr *items);
+
+#endif /* AVL_PERSISTENT_H_ */
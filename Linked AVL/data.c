@@ -35,6 +35,15 @@ int data_compare(data_ptr source, data_ptr target) {
     return (result);
 }
 
+unsigned long long data_hash(data_ptr source) {
+    // splitmix64 finalizer
+    unsigned long long hash = (unsigned int) *source;
+
+    hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebULL;
+    return (hash ^ (hash >> 31));
+}
+
 void data_free(data_ptr *source) {
     free(*source);
     *source = NULL;
@@ -33,8 +33,10 @@ typedef enum boolean {
  *   typedef float *data_ptr;
  *   typedef food_struct *data_ptr;
  *   typedef movie_struct *data_ptr;
+ * data_value names the type itself, for containers that store items inline.
  */
-typedef int *data_ptr;
+typedef int data_value;
+typedef data_value *data_ptr;
 
 /**
  * Returns a string version of a data item.
@@ -63,6 +65,14 @@ void data_copy(data_ptr target, data_ptr source);
  */
 int data_compare(data_ptr target, data_ptr source);
 
+/**
+ * Returns a hash of a data item. Equal items have equal hashes.
+ *
+ * @param source - pointer to source data
+ * @return - hash of source
+ */
+unsigned long long data_hash(data_ptr source);
+
 /**
  * Frees contents of source.
  *
@@ -8,13 +8,56 @@
  * @version 2024-03-01
  *
  */
+#define _POSIX_C_SOURCE 200809L // pthread_rwlock_t
+
 #include <stdio.h>
 #include <stdlib.h>
+#include <time.h>
+#include <pthread.h>
 
 #include "data.h"
 #include "avl_linked.h"
+#include "avl_persistent.h"
+#include "avl_concurrent.h"
+#include "avl_frozen.h"
+#include "avl_compact.h"
+#include "avl_map.h"
+#include "avl_interval.h"
 
 #define MAX_STRING 80
+#define BENCH_KEYS 100000        // keys in benchmark trees
+#define BENCH_OPERATIONS 200000  // operations per benchmark run
+#define BENCH_UPDATES 10         // percentage of operations that are updates
+#define BENCH_LARGE 1000000      // keys in trees larger than the cache
+
+/**
+ * Benchmark thread arguments.
+ */
+typedef struct {
+    void *tree;                 // tree under test
+    pthread_rwlock_t *lock;     // lock for trees that need one
+    int operations;             // operations to perform
+    unsigned int seed;          // random number seed
+} bench_args;
+
+/**
+ * Returns the current time in seconds.
+ */
+static double bench_seconds(void) {
+    struct timespec now;
+    timespec_get(&now, TIME_UTC);
+    return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+/**
+ * Returns the next value of a xorshift random number generator.
+ */
+static unsigned int bench_random(unsigned int *seed) {
+    *seed ^= *seed << 13;
+    *seed ^= *seed >> 17;
+    *seed ^= *seed << 5;
+    return *seed;
+}
 
 /**
  * Simple AVL testing.
@@ -94,6 +137,602 @@ void test_avl(void) {
     avl_free(&source);
 }
 
+/**
+ * Simple persistent AVL testing.
+ */
+void test_avl_persistent(void) {
+    int numbers[] = {11, 7, 6, 9, 8, 15, 12, 18};
+    int count = sizeof numbers / sizeof *numbers;
+    data_ptr values[count];
+
+    avl_persistent *source = avl_persistent_initialize();
+
+    for(int i = 0; i < count; i++) {
+        avl_persistent_insert(source, &numbers[i]);
+    }
+    // Take a snapshot, then keep writing.
+    avl_version *before = avl_persistent_acquire(source);
+    int removed = 0;
+    avl_persistent_remove(source, &numbers[0], &removed);
+    avl_persistent_remove(source, &numbers[3], &removed);
+    avl_version *after = avl_persistent_acquire(source);
+
+    printf("snapshot before:  {");
+    avl_version_inorder(before, values);
+
+    for(int i = 0; i < avl_version_count(before); i++) {
+        printf("%d, ", *values[i]);
+    }
+    printf("}\n");
+    printf("snapshot after:   {");
+    avl_version_inorder(after, values);
+
+    for(int i = 0; i < avl_version_count(after); i++) {
+        printf("%d, ", *values[i]);
+    }
+    printf("}\n");
+    int item = 0;
+    printf("before has %d: %s\n", numbers[0],
+            BOOL_TO_STR(avl_version_retrieve(before, &numbers[0], &item)));
+    printf("after has %d:  %s\n", numbers[0],
+            BOOL_TO_STR(avl_version_retrieve(after, &numbers[0], &item)));
+
+    avl_version_release(&before);
+    avl_version_release(&after);
+    avl_persistent_free(&source);
+}
+
+/**
+ * Mixed retrieve/update workload on a concurrent AVL.
+ */
+static void* bench_concurrent_worker(void *arg) {
+    bench_args *args = arg;
+    avl_concurrent *tree = args->tree;
+    int item = 0;
+
+    for(int i = 0; i < args->operations; i++) {
+        unsigned int r = bench_random(&args->seed);
+        int key = (r >> 8) % (BENCH_KEYS * 2);
+
+        if(r % 100 >= BENCH_UPDATES) {
+            avl_concurrent_retrieve(tree, &key, &item);
+        } else if(r & 0x80) {
+            avl_concurrent_insert(tree, &key);
+        } else {
+            avl_concurrent_remove(tree, &key, &item);
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Mixed retrieve/update workload on an AVL guarded by a readers-writer lock.
+ */
+static void* bench_locked_worker(void *arg) {
+    bench_args *args = arg;
+    avl_linked *tree = args->tree;
+    int item = 0;
+
+    for(int i = 0; i < args->operations; i++) {
+        unsigned int r = bench_random(&args->seed);
+        int key = (r >> 8) % (BENCH_KEYS * 2);
+
+        if(r % 100 >= BENCH_UPDATES) {
+            pthread_rwlock_rdlock(args->lock);
+            avl_retrieve(tree, &key, &item);
+        } else if(r & 0x80) {
+            pthread_rwlock_wrlock(args->lock);
+            avl_insert(tree, &key);
+        } else {
+            pthread_rwlock_wrlock(args->lock);
+            avl_remove(tree, &key, &item);
+        }
+        pthread_rwlock_unlock(args->lock);
+    }
+    return NULL;
+}
+
+/**
+ * Runs a workload on threads threads and returns millions of operations
+ * per second.
+ */
+static double bench_run(void* (*worker)(void*), void *tree,
+        pthread_rwlock_t *lock, int threads) {
+    pthread_t ids[threads];
+    bench_args args[threads];
+    double start = bench_seconds();
+
+    for(int i = 0; i < threads; i++) {
+        args[i].tree = tree;
+        args[i].lock = lock;
+        args[i].operations = BENCH_OPERATIONS / threads;
+        args[i].seed = 2463534242u + i;
+        pthread_create(&ids[i], NULL, worker, &args[i]);
+    }
+    for(int i = 0; i < threads; i++) {
+        pthread_join(ids[i], NULL);
+    }
+    return BENCH_OPERATIONS / (bench_seconds() - start) / 1e6;
+}
+
+/**
+ * One retrieve from a concurrent AVL, as a short-lived thread.
+ */
+static void* test_avl_concurrent_retrieve(void *arg) {
+    bench_args *args = arg;
+    int key = args->seed % BENCH_KEYS;
+    int item = 0;
+
+    args->operations = avl_concurrent_retrieve(args->tree, &key, &item)
+            && item == key;
+    return NULL;
+}
+
+/**
+ * Starts and joins more short-lived threads than there are epoch slots,
+ * each doing one retrieve: slots of exited threads must be reused.
+ */
+void test_avl_concurrent_threads(void) {
+    avl_concurrent *tree = avl_concurrent_initialize();
+    int threads = AVL_CONCURRENT_MAX_THREADS * 2;
+    int found = 0;
+
+    for(int key = 0; key < BENCH_KEYS; key++) {
+        avl_concurrent_insert(tree, &key);
+    }
+    for(int i = 0; i < threads; i += 8) {
+        pthread_t ids[8];
+        bench_args args[8];
+
+        for(int t = 0; t < 8; t++) {
+            args[t].tree = tree;
+            args[t].seed = (i + t) * 7919u;
+            pthread_create(&ids[t], NULL, test_avl_concurrent_retrieve, &args[t]);
+        }
+        for(int t = 0; t < 8; t++) {
+            pthread_join(ids[t], NULL);
+            found += args[t].operations;
+        }
+    }
+    printf("%d threads retrieved %d of %d keys\n", threads, found, threads);
+    avl_concurrent_free(&tree);
+}
+
+/**
+ * Counts the nodes below a concurrent AVL node, routing nodes included.
+ *
+ * @param node - pointer to a node
+ * @return - number of nodes below node
+ */
+static int test_avl_concurrent_nodes(avl_cnode *node) {
+    int nodes = 0;
+
+    if (node != NULL) {
+        nodes = 1 + test_avl_concurrent_nodes(atomic_load(&node->left))
+                + test_avl_concurrent_nodes(atomic_load(&node->right));
+    }
+    return nodes;
+}
+
+/**
+ * Inserts BENCH_KEYS new random keys and removes them all, several times:
+ * every removed node must be unlinked, so no nodes are left.
+ */
+void test_avl_concurrent_churn(void) {
+    avl_concurrent *tree = avl_concurrent_initialize();
+    int *keys = malloc(BENCH_KEYS * sizeof *keys);
+    unsigned int seed = 17;
+
+    for(int round = 0; round < 4; round++) {
+        for(int i = 0; i < BENCH_KEYS; i++) {
+            keys[i] = round * BENCH_LARGE + bench_random(&seed) % BENCH_LARGE;
+            avl_concurrent_insert(tree, &keys[i]);
+        }
+        int inserted = avl_concurrent_count(tree);
+
+        // 7919 is prime, so this visits every key in a scattered order.
+        for(int i = 0; i < BENCH_KEYS; i++) {
+            int item = 0;
+            avl_concurrent_remove(tree, &keys[(long) i * 7919 % BENCH_KEYS],
+                    &item);
+        }
+        printf("churn round %d: inserted %d, count %d, nodes %d\n", round,
+                inserted, avl_concurrent_count(tree),
+                test_avl_concurrent_nodes(atomic_load(&tree->root)));
+    }
+    free(keys);
+    avl_concurrent_free(&tree);
+}
+
+/**
+ * Compares the concurrent AVL with an rwlock-guarded AVL at 1-64 threads.
+ */
+void bench_avl_concurrent(void) {
+    printf("threads  concurrent Mops/s  rwlock Mops/s\n");
+
+    for(int threads = 1; threads <= 64; threads *= 2) {
+        avl_concurrent *concurrent = avl_concurrent_initialize();
+        avl_linked *locked = avl_initialize();
+        pthread_rwlock_t lock;
+        pthread_rwlock_init(&lock, NULL);
+
+        for(int key = 0; key < BENCH_KEYS * 2; key += 2) {
+            avl_concurrent_insert(concurrent, &key);
+            avl_insert(locked, &key);
+        }
+        double fast = bench_run(bench_concurrent_worker, concurrent, NULL, threads);
+        double slow = bench_run(bench_locked_worker, locked, &lock, threads);
+        printf("%7d  %17.2f  %13.2f\n", threads, fast, slow);
+
+        pthread_rwlock_destroy(&lock);
+        avl_free(&locked);
+        avl_concurrent_free(&concurrent);
+    }
+}
+
+/**
+ * Simple frozen AVL testing.
+ */
+void test_avl_frozen(void) {
+    int numbers[] = {11, 7, 6, 9, 8, 15, 12, 18};
+    int count = sizeof numbers / sizeof *numbers;
+    avl_linked *source = avl_initialize();
+
+    for(int i = 0; i < count; i++) {
+        avl_insert(source, &numbers[i]);
+    }
+    avl_frozen *frozen = avl_freeze(source);
+    printf("frozen keys:   {");
+
+    for(int i = 1; i <= avl_frozen_count(frozen); i++) {
+        printf("%d, ", frozen->keys[i]);
+    }
+    printf("}\n");
+    avl_frozen_save(frozen, "avl_frozen.bin");
+    avl_frozen *loaded = avl_frozen_load("avl_frozen.bin");
+    int item = 0;
+
+    for(int key = 5; key <= 19; key += 2) {
+        printf("loaded has %d: %s\n", key,
+                BOOL_TO_STR(avl_frozen_retrieve(loaded, &key, &item)));
+    }
+    avl_frozen_free(&loaded);
+    avl_frozen_free(&frozen);
+    remove("avl_frozen.bin");
+    avl_free(&source);
+}
+
+/**
+ * Simple compact AVL testing.
+ */
+void test_avl_compact(void) {
+    int numbers[] = {11, 7, 6, 9, 8, 15, 12, 18};
+    int count = sizeof numbers / sizeof *numbers;
+    data_ptr values[count];
+    avl_compact *source = avl_compact_initialize();
+
+    printf("node size: avl_node %zu + item %zu, avl_compact_node %zu\n",
+            sizeof(avl_node), sizeof(data_value), sizeof(avl_compact_node));
+
+    for(int i = 0; i < count; i++) {
+        avl_compact_insert(source, &numbers[i]);
+    }
+    int item = 0;
+    avl_compact_remove(source, &numbers[0], &item);
+    printf("  removed: %d\n", item);
+    // The freed slot is reused by the next insert.
+    avl_compact_insert(source, &numbers[0]);
+    printf("compact inorder: {");
+    avl_compact_inorder(source, values);
+
+    for(int i = 0; i < avl_compact_count(source); i++) {
+        printf("%d, ", *values[i]);
+    }
+    printf("} slots used: %u\n", source->used - 1);
+    avl_compact_free(&source);
+}
+
+/**
+ * Prints an item reported by avl_diff.
+ */
+static void test_avl_diff_report(data_ptr item, BOOLEAN in_target,
+        void *context) {
+    printf("  only in %s: %d\n", in_target ? "target" : "source", *item);
+}
+
+/**
+ * Simple AVL comparison testing.
+ */
+void test_avl_diff(void) {
+    avl_linked *target = avl_initialize();
+    avl_linked *source = avl_initialize();
+    int item = 0;
+
+    for(int i = 0; i < 1000; i++) {
+        avl_insert(target, &i);
+        avl_insert(source, &i);
+    }
+    printf("equals: %s\n", BOOL_TO_STR(avl_equals(target, source)));
+    int key = 500;
+    avl_remove(target, &key, &item);
+    key = 1000;
+    avl_insert(source, &key);
+    printf("equals: %s\n", BOOL_TO_STR(avl_equals(target, source)));
+    printf("differences: %d\n",
+            avl_diff(target, source, test_avl_diff_report, NULL));
+    avl_free(&target);
+    avl_free(&source);
+}
+
+/**
+ * Adds one to a counter stored in an AVL map.
+ */
+static void test_avl_map_count(void *value, BOOLEAN inserted, void *context) {
+    (*(long*) value)++;
+}
+
+/**
+ * Simple AVL map testing, and counting with avl_map_update compared to a
+ * remove and re-insert for every change.
+ */
+void test_avl_map(void) {
+    int words[] = {4, 8, 15, 16, 23, 42, 8, 15, 8};
+    int count = sizeof words / sizeof *words;
+    avl_map *source = avl_map_initialize(sizeof(long));
+
+    for(int i = 0; i < count; i++) {
+        avl_map_update(source, &words[i], test_avl_map_count, NULL);
+    }
+    long value = 100;
+    avl_map_upsert(source, &words[0], &value);
+    long *ref = avl_map_get_ref(source, &words[5]);
+    *ref += 10;
+    data_ptr keys[avl_map_count(source)];
+    void *values[avl_map_count(source)];
+    avl_map_inorder(source, keys, values);
+    printf("map: {");
+
+    for(int i = 0; i < avl_map_count(source); i++) {
+        printf("%d: %ld, ", *keys[i], *(long*) values[i]);
+    }
+    printf("}\n");
+    avl_map_free(&source);
+
+    int *numbers = malloc(BENCH_OPERATIONS * sizeof *numbers);
+    unsigned int seed = 1;
+
+    for(int i = 0; i < BENCH_OPERATIONS; i++) {
+        numbers[i] = bench_random(&seed) % BENCH_KEYS;
+    }
+    source = avl_map_initialize(sizeof(long));
+    double start = bench_seconds();
+
+    for(int i = 0; i < BENCH_OPERATIONS; i++) {
+        avl_map_update(source, &numbers[i], test_avl_map_count, NULL);
+    }
+    double update_time = bench_seconds() - start;
+    avl_map_free(&source);
+    source = avl_map_initialize(sizeof(long));
+    start = bench_seconds();
+
+    for(int i = 0; i < BENCH_OPERATIONS; i++) {
+        value = 0;
+        avl_map_remove(source, &numbers[i], &value);
+        value++;
+        avl_map_upsert(source, &numbers[i], &value);
+    }
+    double replace_time = bench_seconds() - start;
+    printf("%d counter updates: update %.3fs, remove + insert %.3fs\n",
+            BENCH_OPERATIONS, update_time, replace_time);
+    avl_map_free(&source);
+    free(numbers);
+}
+
+/**
+ * Prints an interval reported by an interval tree query.
+ */
+static void test_avl_interval_report(data_ptr low, data_ptr high,
+        void *context) {
+    printf("[%d, %d], ", *low, *high);
+}
+
+/**
+ * Simple interval tree testing, and stabbing queries compared to a linear
+ * scan over the same intervals.
+ */
+void test_avl_interval(void) {
+    int ranges[][2] = {{15, 20}, {10, 30}, {17, 19}, {5, 20}, {12, 15},
+            {30, 40}};
+    int count = sizeof ranges / sizeof *ranges;
+    avl_interval_tree *source = avl_interval_initialize();
+
+    for(int i = 0; i < count; i++) {
+        avl_interval_insert(source, &ranges[i][0], &ranges[i][1]);
+    }
+    int point = 16;
+    printf("contain %d: {", point);
+    avl_interval_stab(source, &point, test_avl_interval_report, NULL);
+    int low = 21;
+    int high = 30;
+    printf("}\noverlap [%d, %d]: {", low, high);
+    avl_interval_overlap(source, &low, &high, test_avl_interval_report, NULL);
+    printf("}\n");
+    avl_interval_free(&source);
+
+    int (*intervals)[2] = malloc(BENCH_LARGE * sizeof *intervals);
+    unsigned int seed = 1;
+    source = avl_interval_initialize();
+
+    for(int i = 0; i < BENCH_LARGE; i++) {
+        intervals[i][0] = bench_random(&seed) % (BENCH_LARGE * 100);
+        intervals[i][1] = intervals[i][0] + bench_random(&seed) % 1000;
+        avl_interval_insert(source, &intervals[i][0], &intervals[i][1]);
+    }
+    int queries = 100;
+    int tree_found = 0;
+    int scan_found = 0;
+    double start = bench_seconds();
+
+    for(int q = 0; q < queries; q++) {
+        point = q * BENCH_LARGE;
+        tree_found += avl_interval_stab(source, &point, NULL, NULL);
+    }
+    double tree_time = bench_seconds() - start;
+    start = bench_seconds();
+
+    for(int q = 0; q < queries; q++) {
+        point = q * BENCH_LARGE;
+
+        for(int i = 0; i < BENCH_LARGE; i++) {
+            scan_found += (intervals[i][0] <= point && point <= intervals[i][1]);
+        }
+    }
+    double scan_time = bench_seconds() - start;
+    printf("%d stabs of %d intervals: tree %.6fs, scan %.3fs (%d, %d found)\n",
+            queries, avl_interval_count(source), tree_time, scan_time,
+            tree_found, scan_found);
+    avl_interval_free(&source);
+    free(intervals);
+}
+
+/**
+ * Compares avl_retrieve, avl_retrieve_many, a frozen index and a compact
+ * AVL on a tree larger than the cache.
+ */
+void bench_avl_lookups(void) {
+    int *keys = malloc(BENCH_LARGE * sizeof *keys);
+    int *values = malloc(BENCH_LARGE * sizeof *values);
+    data_ptr *key_ptrs = malloc(BENCH_LARGE * sizeof *key_ptrs);
+    data_ptr *items = malloc(BENCH_LARGE * sizeof *items);
+    BOOLEAN *found = malloc(BENCH_LARGE * sizeof *found);
+    unsigned int seed = 2463534242u;
+    avl_linked *source = avl_initialize();
+    avl_compact *compact = avl_compact_initialize();
+
+    for(int i = 0; i < BENCH_LARGE; i++) {
+        keys[i] = bench_random(&seed);
+        avl_insert(source, &keys[i]);
+        avl_compact_insert(compact, &keys[i]);
+    }
+    for(int i = 0; i < BENCH_LARGE; i++) {
+        keys[i] = keys[bench_random(&seed) % BENCH_LARGE];
+        key_ptrs[i] = &keys[i];
+        items[i] = &values[i];
+    }
+    int single = 0;
+    double start = bench_seconds();
+
+    for(int i = 0; i < BENCH_LARGE; i++) {
+        single += avl_retrieve(source, key_ptrs[i], items[i]);
+    }
+    double single_time = bench_seconds() - start;
+    start = bench_seconds();
+    int batched = avl_retrieve_many(source, key_ptrs, BENCH_LARGE, items, found);
+    double batched_time = bench_seconds() - start;
+
+    printf("avl_retrieve:      %d found, %.1f ns/key\n", single,
+            single_time * 1e9 / BENCH_LARGE);
+    printf("avl_retrieve_many: %d found, %.1f ns/key\n", batched,
+            batched_time * 1e9 / BENCH_LARGE);
+
+    avl_frozen *frozen = avl_freeze(source);
+    int frozen_found = 0;
+    start = bench_seconds();
+
+    for(int i = 0; i < BENCH_LARGE; i++) {
+        frozen_found += avl_frozen_retrieve(frozen, key_ptrs[i], items[i]);
+    }
+    double frozen_time = bench_seconds() - start;
+    printf("avl_frozen:        %d found, %.1f ns/key\n", frozen_found,
+            frozen_time * 1e9 / BENCH_LARGE);
+
+    int compact_found = 0;
+    start = bench_seconds();
+
+    for(int i = 0; i < BENCH_LARGE; i++) {
+        compact_found += avl_compact_retrieve(compact, key_ptrs[i], items[i]);
+    }
+    double compact_time = bench_seconds() - start;
+    printf("avl_compact:       %d found, %.1f ns/key\n", compact_found,
+            compact_time * 1e9 / BENCH_LARGE);
+
+    avl_compact_free(&compact);
+    avl_frozen_free(&frozen);
+    avl_free(&source);
+    free(found);
+    free(items);
+    free(key_ptrs);
+    free(values);
+    free(keys);
+}
+
+/**
+ * Times inserting then removing BENCH_KEYS keys, keeping the best times.
+ */
+static void bench_avl_update_run(BOOLEAN (*insert)(avl_linked*, const data_ptr),
+        BOOLEAN (*remove)(avl_linked*, const data_ptr, data_ptr), int *keys,
+        double *insert_time, double *remove_time) {
+    avl_linked *source = avl_initialize();
+    int item = 0;
+    double start = bench_seconds();
+
+    for(int i = 0; i < BENCH_KEYS; i++) {
+        insert(source, &keys[i]);
+    }
+    double middle = bench_seconds();
+
+    for(int i = 0; i < BENCH_KEYS; i++) {
+        remove(source, &keys[i], &item);
+    }
+    double end = bench_seconds();
+    avl_free(&source);
+
+    if(*insert_time == 0 || middle - start < *insert_time) {
+        *insert_time = middle - start;
+    }
+    if(*remove_time == 0 || end - middle < *remove_time) {
+        *remove_time = end - middle;
+    }
+}
+
+/**
+ * Compares the recursive and the iterative AVL insert and remove on keys.
+ * The two alternate so both see the same allocator state.
+ */
+static void bench_avl_update_pattern(const char *pattern, int *keys) {
+    double times[4] = {0, 0, 0, 0};
+
+    for(int round = 0; round < 5; round++) {
+        bench_avl_update_run(avl_insert, avl_remove, keys, &times[0], &times[1]);
+        bench_avl_update_run(avl_insert_iterative, avl_remove_iterative, keys,
+                &times[2], &times[3]);
+    }
+    printf("%-10s  insert %6.1f / %6.1f ns  remove %6.1f / %6.1f ns\n", pattern,
+            times[0] * 1e9 / BENCH_KEYS, times[2] * 1e9 / BENCH_KEYS,
+            times[1] * 1e9 / BENCH_KEYS, times[3] * 1e9 / BENCH_KEYS);
+}
+
+/**
+ * Compares recursive and iterative AVL updates on random and sequential keys.
+ */
+void bench_avl_updates(void) {
+    int *keys = malloc(BENCH_KEYS * sizeof *keys);
+    unsigned int seed = 2463534242u;
+
+    printf("keys        recursive / iterative per operation\n");
+
+    for(int i = 0; i < BENCH_KEYS; i++) {
+        keys[i] = bench_random(&seed);
+    }
+    bench_avl_update_pattern("random", keys);
+
+    for(int i = 0; i < BENCH_KEYS; i++) {
+        keys[i] = i;
+    }
+    bench_avl_update_pattern("sequential", keys);
+    free(keys);
+}
+
 /**
  * Test the file and string functions.
  *
@@ -105,6 +744,17 @@ int main(int argc, char *argv[]) {
     setbuf(stdout, NULL);
 
     test_avl();
+    test_avl_persistent();
+    test_avl_frozen();
+    test_avl_compact();
+    test_avl_diff();
+    test_avl_map();
+    test_avl_interval();
+    test_avl_concurrent_threads();
+    test_avl_concurrent_churn();
+    bench_avl_concurrent();
+    bench_avl_lookups();
+    bench_avl_updates();
 
     return (EXIT_SUCCESS);
 }
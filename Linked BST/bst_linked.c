@@ -10,6 +10,8 @@
  */
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdatomic.h>
+#include <pthread.h>
 #include "data.h"
 #include "bst_linked.h"
 
@@ -32,11 +34,28 @@ static bst_node* bst_node_initialize(const data_ptr item) {
 	node->item = malloc(sizeof *node->item);
 	data_copy(node->item, item);
 	node->height = 1;
+	node->deleted = FALSE;
 	node->left = NULL;
 	node->right = NULL;
 	return node;
 }
 
+/**
+ * Frees a node and its item, unless they belong to the block allocated by
+ * bst_copy, which is freed as a whole by bst_free.
+ *
+ * @param source - pointer to a BST
+ * @param node - the node to free
+ */
+static void bst_node_free(const bst_linked *source, bst_node *node) {
+
+	if (node < source->block || node >= source->block + source->block_count) {
+		data_free(&node->item);
+		free(node);
+	}
+	return;
+}
+
 /**
  * Helper function to determine the height of node - handles empty node.
  * @param node - The node to process.
@@ -64,103 +83,700 @@ static void bst_update_height(bst_node *node) {
 	return;
 }
 
+/**
+ * Returns the difference between the heights of a node's children.
+ * @param node - The node to process.
+ * @return the imbalance of node, capped at BST_MAX_IMBALANCE - 1
+ */
+static int bst_imbalance(const bst_node *node) {
+	int imbalance = abs(bst_node_height(node->left)
+			- bst_node_height(node->right));
+
+	if (imbalance >= BST_MAX_IMBALANCE) {
+		imbalance = BST_MAX_IMBALANCE - 1;
+	}
+	return imbalance;
+}
+
+/**
+ * Adds a node's child count and imbalance to the BST statistics, or takes
+ * them away.
+ * @param source - pointer to a BST
+ * @param node - The node to process.
+ * @param delta - 1 to add the node, -1 to take it away
+ */
+static void bst_stats_node(bst_linked *source, const bst_node *node,
+		int delta) {
+	source->child_counts[(node->left != NULL) + (node->right != NULL)] +=
+			delta;
+	source->imbalances[bst_imbalance(node)] += delta;
+	return;
+}
+
+/**
+ * Adds every node of a subtree to the BST statistics, or takes them away.
+ * @param source - pointer to a BST
+ * @param node - The node to process.
+ * @param delta - 1 to add the nodes, -1 to take them away
+ */
+static void bst_stats_aux(bst_linked *source, const bst_node *node,
+		int delta) {
+
+	if (node != NULL) {
+		bst_stats_node(source, node, delta);
+		bst_stats_aux(source, node->left, delta);
+		bst_stats_aux(source, node->right, delta);
+	}
+	return;
+}
+
+/**
+ * Returns the floor of log2 of a positive count, without the math library.
+ * @param count - the number to process
+ * @return the position of the highest set bit of count
+ */
+static int bst_log2(int count) {
+	int log = 0;
+
+	while (count > 1) {
+		count >>= 1;
+		log++;
+	}
+	return log;
+}
+
+/**
+ * Determines whether a subtree is taller than BST_ALPHA * log2(size) edges.
+ * @param height - the height of the subtree in nodes
+ * @param size - the number of nodes in the subtree
+ * @return TRUE if the subtree is too tall, FALSE otherwise
+ */
+static BOOLEAN bst_too_tall(int height, int size) {
+	return (height - 1 > BST_ALPHA * bst_log2(size));
+}
+
+/**
+ * Counts the nodes in a subtree.
+ * @param node - The node to process.
+ * @return the number of nodes below and including node
+ */
+static int bst_size_aux(const bst_node *node) {
+	int size = 0;
+
+	if (node != NULL) {
+		size = bst_size_aux(node->left) + 1 + bst_size_aux(node->right);
+	}
+	return size;
+}
+
+/**
+ * Recomputes the heights of a subtree from its leaves up.
+ * @param node - The node to process.
+ * @return The height of the node.
+ */
+static int bst_heights_aux(bst_node *node) {
+	int height = 0;
+
+	if (node != NULL) {
+		int left_height = bst_heights_aux(node->left);
+		int right_height = bst_heights_aux(node->right);
+		node->height = MAX_HEIGHT(left_height, right_height) + 1;
+		height = node->height;
+	}
+	return height;
+}
+
+/**
+ * Rotates the first count right-vine nodes below root to the left, which
+ * turns every other vine node into the left child of the node after it.
+ * @param root - pseudo-root whose right link is the vine
+ * @param count - number of rotations
+ */
+static void bst_compress(bst_node *root, int count) {
+	bst_node *scanner = root;
+
+	for (int i = 0; i < count; i++) {
+		bst_node *child = scanner->right;
+		scanner->right = child->right;
+		scanner = scanner->right;
+		child->right = scanner->left;
+		scanner->left = child;
+	}
+	return;
+}
+
+/**
+ * Rebuilds a subtree into a balanced shape with the Day-Stout-Warren
+ * algorithm: right rotations straighten it into a vine linked through
+ * right children, then rounds of left rotations fold the vine into a
+ * complete tree. Tombstones are unlinked and freed as the vine is built.
+ * Heights in the subtree are recomputed.
+ * @param source - pointer to a BST
+ * @param node - link to the root of the subtree
+ */
+static void bst_rebuild(bst_linked *source, bst_node **node) {
+	bst_stats_aux(source, *node, -1);
+	bst_node root;
+	root.right = *node;
+	bst_node *tail = &root;
+	bst_node *rest = tail->right;
+	int size = 0;
+
+	// Tree to vine.
+	while (rest != NULL) {
+		if (rest->left == NULL && rest->deleted) {
+			tail->right = rest->right;
+			bst_node_free(source, rest);
+			source->tombstones--;
+			rest = tail->right;
+		} else if (rest->left == NULL) {
+			tail = rest;
+			rest = rest->right;
+			size++;
+		} else {
+			bst_node *temp = rest->left;
+			rest->left = temp->right;
+			temp->right = rest;
+			rest = temp;
+			tail->right = temp;
+		}
+	}
+	// Vine to tree: first fill the bottom level, then halve the vine.
+	int full = 1;
+
+	while (full <= size + 1) {
+		full <<= 1;
+	}
+	full = (full >> 1) - 1;
+	bst_compress(&root, size - full);
+	size = full;
+
+	while (size > 1) {
+		size >>= 1;
+		bst_compress(&root, size);
+	}
+	*node = root.right;
+	bst_heights_aux(*node);
+	bst_stats_aux(source, *node, 1);
+	return;
+}
+
 /**
  * Inserts item into a BST. Insertion must preserve the BST definition.
- * item may appear only once in source.
+ * item may appear only once in source. A tombstone matching item is
+ * brought back to life. If the new node is deeper than the bound, the
+ * lowest subtree on the way back up that is too tall for its size is
+ * rebuilt.
  *
  * @param source - pointer to a BST
  * @param node - pointer to a node
  * @param item - the item to insert
+ * @param depth - number of edges from the root to node
+ * @param size - set to the size of the subtree at node while a rebuild is
+ * pending, 0 otherwise
  * @return - TRUE if item inserted, FALSE otherwise
  */
 static BOOLEAN bst_insert_aux(bst_linked *source, bst_node **node,
-		const data_ptr item) {
+		const data_ptr item, int depth, int *size) {
 	BOOLEAN inserted = FALSE;
 
 	if (*node == NULL) {
 		// Base case: add a new node containing the item.
 		*node = bst_node_initialize(item);
+		bst_stats_node(source, *node, 1);
 		source->count += 1;
 		inserted = TRUE;
+
+		if (depth > BST_ALPHA * bst_log2(source->count + source->tombstones)) {
+			*size = 1;
+		}
 	} else {
 		// Compare the node data_ptr against the new item.
 		int comp = data_compare(item, (*node)->item);
+		// The node's statistics are added back once its children settle.
+		bst_stats_node(source, *node, -1);
 
 		if (comp < 0) {
 			// General case: check the left subsource.
-			inserted = bst_insert_aux(source, &(*node)->left, item);
+			inserted = bst_insert_aux(source, &(*node)->left, item, depth + 1,
+					size);
+
+			if (*size > 0) {
+				*size += 1 + bst_size_aux((*node)->right);
+			}
 		} else if (comp > 0) {
 			// General case: check the right subsource.
-			inserted = bst_insert_aux(source, &(*node)->right, item);
+			inserted = bst_insert_aux(source, &(*node)->right, item,
+					depth + 1, size);
+
+			if (*size > 0) {
+				*size += 1 + bst_size_aux((*node)->left);
+			}
+		} else if ((*node)->deleted) {
+			data_copy((*node)->item, item);
+			(*node)->deleted = FALSE;
+			source->count += 1;
+			source->tombstones -= 1;
+			inserted = TRUE;
 		}
-	}
-	if (inserted) {
-		// Update the node height if any of its children have been changed.
+		// Update the node height in case one of its children has changed.
 		bst_update_height(*node);
+		bst_stats_node(source, *node, 1);
+	}
+	if (*size > 0 && bst_too_tall((*node)->height, *size)) {
+		// This node is the scapegoat.
+		bst_rebuild(source, node);
+		*size = 0;
 	}
 	return inserted;
 }
 
-static BOOLEAN bst_balanced_aux(bst_node *node, BOOLEAN balanced) {
-	if (node == NULL) {
-		node = NULL;
-	} else if (node->left != NULL && node->right != NULL) {
-		if (abs(node->left->height - node->right->height) > 1) {
-			balanced = FALSE;
+/**
+ * Copies the live items of a node and its children to an array in
+ * preorder.
+ *
+ * @param items - array of items
+ * @param node - pointer to a node
+ * @param index - current index in array
+ * @return - the updated index
+ */
+static int bst_preorder_aux(data_ptr *items, const bst_node *node, int index) {
+
+	if (node != NULL) {
+		if (!node->deleted) {
+			items[index] = node->item;
+			index++;
+		}
+		index = bst_preorder_aux(items, node->left, index);
+		index = bst_preorder_aux(items, node->right, index);
+	}
+	return index;
+}
+
+/**
+ * Copies the live items of a node and its children to an array in
+ * postorder.
+ *
+ * @param items - array of items
+ * @param node - pointer to a node
+ * @param index - current index in array
+ * @return - the updated index
+ */
+static int bst_postorder_aux(data_ptr *items, const bst_node *node, int index) {
+
+	if (node != NULL) {
+		index = bst_postorder_aux(items, node->left, index);
+		index = bst_postorder_aux(items, node->right, index);
+
+		if (!node->deleted) {
+			items[index] = node->item;
+			index++;
+		}
+	}
+	return index;
+}
+
+/**
+ * Checks the order and heights of a subtree and totals its node
+ * statistics into stats.
+ *
+ * @param stats - BST header that collects counts and statistics
+ * @param node - pointer to a node
+ * @param low - items must be greater than low, NULL for no bound
+ * @param high - items must be less than high, NULL for no bound
+ * @return - height of node, -1 if the subtree is not valid
+ */
+static int bst_valid_aux(bst_linked *stats, const bst_node *node,
+		const data_ptr low, const data_ptr high) {
+	int height = 0;
+
+	if (node != NULL) {
+		int left_height = bst_valid_aux(stats, node->left, low, node->item);
+		int right_height = bst_valid_aux(stats, node->right, node->item,
+				high);
+
+		if (left_height < 0 || right_height < 0
+				|| (low != NULL && data_compare(node->item, low) <= 0)
+				|| (high != NULL && data_compare(node->item, high) >= 0)
+				|| node->height != MAX_HEIGHT(left_height, right_height) + 1) {
+			height = -1;
 		} else {
-			balanced = bst_balanced_aux(node->left, balanced);
-			balanced = bst_balanced_aux(node->right, balanced);
+			height = node->height;
+			bst_stats_node(stats, node, 1);
+
+			if (node->deleted) {
+				stats->tombstones++;
+			} else {
+				stats->count++;
+			}
 		}
-	} else if (node->left == NULL && node->right != NULL) {
-		if (node->right->height > 1) {
-			balanced = FALSE;
+	}
+	return height;
+}
+
+/**
+ * Frees a node and its children.
+ *
+ * @param source - pointer to a BST
+ * @param node - pointer to a node
+ */
+static void bst_free_aux(const bst_linked *source, bst_node *node) {
+
+	if (node != NULL) {
+		bst_free_aux(source, node->left);
+		bst_free_aux(source, node->right);
+		bst_node_free(source, node);
+	}
+	return;
+}
+
+/**
+ * A subtree, or a single node above the subtrees, handled as one unit of
+ * parallel work.
+ */
+typedef struct {
+	const bst_node *node;    // Root of the subtree, or the single node.
+	const bst_node *other;   // bst_equals: matching subtree of the other BST.
+	BOOLEAN single;          // TRUE if only node itself belongs to the unit.
+	int size;                // Nodes or items in the unit.
+	int offset;              // Position of the unit's first node or item.
+	BOOLEAN result;          // bst_equals: TRUE if the subtrees are equal.
+} bst_task;
+
+/**
+ * Parallel work: units and the output they write to.
+ */
+typedef struct bst_job {
+	bst_task *tasks;         // Units of work.
+	int count;               // Number of units.
+	atomic_int next;         // Index of the next unit to hand out.
+	bst_node *nodes;         // bst_copy: block of copied nodes.
+	data_ptr node_items;     // bst_copy: items of the copied nodes.
+	data_ptr *items;         // bst_inorder: output array.
+	void (*work)(struct bst_job *job, bst_task *task); // Handles one unit.
+} bst_job;
+
+/**
+ * Collects the nodes above BST_FRONTIER_DEPTH and the subtrees at that
+ * depth as units, in inorder.
+ *
+ * @param node - pointer to a node
+ * @param depth - depth of node
+ * @param tasks - array of units
+ * @param count - number of units, updated
+ */
+static void bst_frontier(const bst_node *node, int depth, bst_task *tasks,
+		int *count) {
+
+	if (node != NULL) {
+		if (depth == BST_FRONTIER_DEPTH) {
+			tasks[*count].node = node;
+			tasks[*count].single = FALSE;
+			(*count)++;
 		} else {
-			balanced = bst_balanced_aux(node->left, balanced);
+			bst_frontier(node->left, depth + 1, tasks, count);
+			tasks[*count].node = node;
+			tasks[*count].single = TRUE;
+			(*count)++;
+			bst_frontier(node->right, depth + 1, tasks, count);
 		}
-	} else if (node->right == NULL && node->left != NULL) {
-		if (node->left->height > 1) {
-			balanced = FALSE;
+	}
+	return;
+}
+
+/**
+ * Hands out units until there are none left.
+ *
+ * @param arg - pointer to a bst_job
+ * @return NULL
+ */
+static void* bst_worker(void *arg) {
+	bst_job *job = arg;
+	int index = atomic_fetch_add(&job->next, 1);
+
+	while (index < job->count) {
+		job->work(job, &job->tasks[index]);
+		index = atomic_fetch_add(&job->next, 1);
+	}
+	return NULL;
+}
+
+/**
+ * Runs work on every unit of a job, on up to BST_THREADS threads
+ * including the caller.
+ *
+ * @param job - pointer to a bst_job
+ * @param work - function that handles one unit
+ * @param parallel - FALSE to run every unit in the caller
+ */
+static void bst_run(bst_job *job, void (*work)(bst_job*, bst_task*),
+		BOOLEAN parallel) {
+	pthread_t threads[BST_THREADS];
+	int count = parallel ? BST_THREADS - 1 : 0;
+
+	if (count > job->count - 1) {
+		count = job->count - 1;
+	}
+	job->work = work;
+	atomic_store(&job->next, 0);
+	int started = 0;
+
+	while (started < count
+			&& pthread_create(&threads[started], NULL, bst_worker, job) == 0) {
+		started++;
+	}
+	bst_worker(job);
+
+	for (int i = 0; i < started; i++) {
+		pthread_join(threads[i], NULL);
+	}
+	return;
+}
+
+/**
+ * Counts the nodes of a subtree, tombstones included.
+ * @param node - The node to process.
+ * @return the number of nodes
+ */
+static int bst_nodes_aux(const bst_node *node) {
+	int size = 0;
+
+	if (node != NULL) {
+		size = bst_nodes_aux(node->left) + 1 + bst_nodes_aux(node->right);
+	}
+	return size;
+}
+
+/**
+ * Counts the live items of a subtree.
+ * @param node - The node to process.
+ * @return the number of items
+ */
+static int bst_items_aux(const bst_node *node) {
+	int size = 0;
+
+	if (node != NULL) {
+		size = bst_items_aux(node->left) + !node->deleted
+				+ bst_items_aux(node->right);
+	}
+	return size;
+}
+
+/**
+ * Sizes a unit by its nodes.
+ * @param job - pointer to a bst_job
+ * @param task - the unit to process
+ */
+static void bst_task_nodes(bst_job *job, bst_task *task) {
+	task->size = task->single ? 1 : bst_nodes_aux(task->node);
+	return;
+}
+
+/**
+ * Sizes a unit by its live items.
+ * @param job - pointer to a bst_job
+ * @param task - the unit to process
+ */
+static void bst_task_items(bst_job *job, bst_task *task) {
+	task->size = task->single ? !task->node->deleted
+			: bst_items_aux(task->node);
+	return;
+}
+
+/**
+ * Sets the offset of each unit to the total size of the units before it.
+ * @param job - pointer to a bst_job
+ */
+static void bst_offsets(bst_job *job) {
+	int offset = 0;
+
+	for (int i = 0; i < job->count; i++) {
+		job->tasks[i].offset = offset;
+		offset += job->tasks[i].size;
+	}
+	return;
+}
+
+/**
+ * Copies one node into block slot index, without its links.
+ * @param job - pointer to a bst_job
+ * @param node - the node to copy
+ * @param index - slot of the copy
+ * @return the copy
+ */
+static bst_node* bst_copy_node(bst_job *job, const bst_node *node, int index) {
+	bst_node *copy = job->nodes + index;
+	copy->item = job->node_items + index;
+	data_copy(copy->item, node->item);
+	copy->height = node->height;
+	copy->deleted = node->deleted;
+	copy->left = NULL;
+	copy->right = NULL;
+	return copy;
+}
+
+/**
+ * Copies a subtree in preorder into consecutive block slots.
+ * @param job - pointer to a bst_job
+ * @param node - The node to copy.
+ * @param index - next free slot, updated
+ * @return the copy of node
+ */
+static bst_node* bst_copy_aux(bst_job *job, const bst_node *node, int *index) {
+	bst_node *copy = NULL;
+
+	if (node != NULL) {
+		copy = bst_copy_node(job, node, *index);
+		(*index)++;
+		copy->left = bst_copy_aux(job, node->left, index);
+		copy->right = bst_copy_aux(job, node->right, index);
+	}
+	return copy;
+}
+
+/**
+ * Copies a subtree unit. Its root lands in the unit's first slot, where
+ * the copies of the nodes above expect it.
+ * @param job - pointer to a bst_job
+ * @param task - the unit to process
+ */
+static void bst_task_copy(bst_job *job, bst_task *task) {
+	int index = task->offset;
+
+	if (!task->single) {
+		bst_copy_aux(job, task->node, &index);
+	}
+	return;
+}
+
+/**
+ * Copies the nodes above BST_FRONTIER_DEPTH and links them to the first
+ * slots of the subtree units, visiting units in the same order as
+ * bst_frontier.
+ * @param job - pointer to a bst_job
+ * @param node - The node to copy.
+ * @param depth - depth of node
+ * @param index - index of the next unit, updated
+ * @return the copy of node
+ */
+static bst_node* bst_copy_top(bst_job *job, const bst_node *node, int depth,
+		int *index) {
+	bst_node *copy = NULL;
+
+	if (node != NULL) {
+		if (depth == BST_FRONTIER_DEPTH) {
+			copy = job->nodes + job->tasks[*index].offset;
+			(*index)++;
 		} else {
-			balanced = bst_balanced_aux(node->right, balanced);
+			bst_node *left = bst_copy_top(job, node->left, depth + 1, index);
+			copy = bst_copy_node(job, node, job->tasks[*index].offset);
+			(*index)++;
+			copy->left = left;
+			copy->right = bst_copy_top(job, node->right, depth + 1, index);
 		}
 	}
-	return balanced;
+	return copy;
 }
 
-static int bst_leaf_count_aux(bst_node *node, int count) {
-	if (node == NULL) {
-		count = 0;
-	} else if (node->left == NULL && node->right == NULL) {
-		count = 1;
+/**
+ * Copies the live items of a subtree to an array in inorder.
+ * @param items - array of items
+ * @param node - The node to process.
+ * @param index - current index in array
+ * @return the updated index
+ */
+static int bst_fill_aux(data_ptr *items, const bst_node *node, int index) {
+
+	if (node != NULL) {
+		index = bst_fill_aux(items, node->left, index);
+
+		if (!node->deleted) {
+			items[index] = node->item;
+			index++;
+		}
+		index = bst_fill_aux(items, node->right, index);
+	}
+	return index;
+}
+
+/**
+ * Copies the live items of a unit to the output array at its offset.
+ * @param job - pointer to a bst_job
+ * @param task - the unit to process
+ */
+static void bst_task_fill(bst_job *job, bst_task *task) {
+
+	if (task->single) {
+		if (!task->node->deleted) {
+			job->items[task->offset] = task->node->item;
+		}
 	} else {
-		count = bst_leaf_count_aux(node->left, count)
-				+ bst_leaf_count_aux(node->right, count);
+		bst_fill_aux(job->items, task->node, task->offset);
 	}
-	return count;
+	return;
 }
 
-static void bst_inorder_aux(data_ptr *items, bst_node *node, int *count,
-		int source_count) {
-	if (node == NULL) {
-		node = NULL;
+/**
+ * Determines if two subtrees are equal, tombstones included.
+ * @param target_node - pointer to a node
+ * @param source_node - pointer to a node
+ * @return TRUE if the subtrees are equal, FALSE otherwise
+ */
+static BOOLEAN bst_equals_aux(const bst_node *target_node,
+		const bst_node *source_node) {
+	BOOLEAN equals = FALSE;
+
+	if (target_node == NULL || source_node == NULL) {
+		equals = (target_node == source_node);
 	} else {
-		bst_inorder_aux(items, node->left, count, source_count);
-		items[source_count - *count] = node->item;
-		(*count)--;
-		bst_inorder_aux(items, node->right, count, source_count);
+		equals = target_node->deleted == source_node->deleted
+				&& data_compare(target_node->item, source_node->item) == 0
+				&& bst_equals_aux(target_node->left, source_node->left)
+				&& bst_equals_aux(target_node->right, source_node->right);
 	}
+	return equals;
 }
 
-static void bst_free_aux(bst_node *node) {
-	if (node == NULL) {
-		node = NULL;
+/**
+ * Compares the nodes of two BSTs above BST_FRONTIER_DEPTH and collects the
+ * pairs of subtrees at that depth as units.
+ * @param target_node - pointer to a node
+ * @param source_node - pointer to a node
+ * @param depth - depth of the nodes
+ * @param tasks - array of units
+ * @param count - number of units, updated
+ * @return FALSE if the nodes above the subtrees differ, TRUE otherwise
+ */
+static BOOLEAN bst_equals_top(const bst_node *target_node,
+		const bst_node *source_node, int depth, bst_task *tasks, int *count) {
+	BOOLEAN equals = FALSE;
+
+	if (target_node == NULL || source_node == NULL) {
+		equals = (target_node == source_node);
+	} else if (depth == BST_FRONTIER_DEPTH) {
+		tasks[*count].node = target_node;
+		tasks[*count].other = source_node;
+		(*count)++;
+		equals = TRUE;
 	} else {
-		data_free(&node->item);
-		bst_free_aux(node->left);
-		bst_free_aux(node->right);
-		free(node);
-		node = NULL;
+		equals = target_node->deleted == source_node->deleted
+				&& data_compare(target_node->item, source_node->item) == 0
+				&& bst_equals_top(target_node->left, source_node->left,
+						depth + 1, tasks, count)
+				&& bst_equals_top(target_node->right, source_node->right,
+						depth + 1, tasks, count);
 	}
+	return equals;
+}
+
+/**
+ * Compares a pair of subtrees.
+ * @param job - pointer to a bst_job
+ * @param task - the unit to process
+ */
+static void bst_task_equals(bst_job *job, bst_task *task) {
+	task->result = bst_equals_aux(task->node, task->other);
+	return;
 }
 
 //--------------------------------------------------------------------
@@ -171,6 +787,12 @@ bst_linked* bst_initialize() {
 	bst_linked *source = malloc(sizeof *source);
 	source->root = NULL;
 	source->count = 0;
+	source->tombstones = 0;
+	source->tombstone_fraction = BST_TOMBSTONE_FRACTION;
+	memset(source->child_counts, 0, sizeof source->child_counts);
+	memset(source->imbalances, 0, sizeof source->imbalances);
+	source->block = NULL;
+	source->block_count = 0;
 	return source;
 }
 
@@ -181,9 +803,9 @@ bst_linked* bst_initialize() {
  */
 void bst_free(bst_linked **source) {
 
-	bst_node *node = (*source)->root;
-	bst_free_aux(node);
+	bst_free_aux(*source, (*source)->root);
 	(*source)->root = NULL;
+	free((*source)->block);
 	free(*source);
 	*source = NULL;
 	return;
@@ -214,33 +836,31 @@ int bst_count(const bst_linked *source) {
 	return (source->count);
 }
 
-/**
- * Copies the contents of a BST to an array in inorder.
- *
- * @param source - pointer to a BST
- * @param items - array of items: length must be at least size of BST
- */
+// Copies the contents of a BST to an array in inorder.
 void bst_inorder(const bst_linked *source, data_ptr *items) {
-	bst_node *node = source->root;
-	int count = source->count;
-	int source_count = source->count;
-	bst_inorder_aux(items, node, &count, source_count);
+	bst_task tasks[2 << BST_FRONTIER_DEPTH];
+	bst_job job;
+	job.tasks = tasks;
+	job.count = 0;
+	job.items = items;
+	BOOLEAN parallel = (source->count + source->tombstones >= BST_PARALLEL_MIN);
+
+	bst_frontier(source->root, 0, tasks, &job.count);
+	bst_run(&job, bst_task_items, parallel);
+	bst_offsets(&job);
+	bst_run(&job, bst_task_fill, parallel);
 	return;
 }
 
 // Copies the contents of a BST to an array in preorder.
 void bst_preorder(const bst_linked *source, data_ptr *items) {
-
-	// your code here
-
+	bst_preorder_aux(items, source->root, 0);
 	return;
 }
 
 // Copies the contents of a BST to an array in postorder.
 void bst_postorder(const bst_linked *source, data_ptr *items) {
-
-	// your code here
-
+	bst_postorder_aux(items, source->root, 0);
 	return;
 }
 
@@ -252,7 +872,14 @@ void bst_postorder(const bst_linked *source, data_ptr *items) {
  * @return - TRUE if item inserted, FALSE otherwise
  */
 BOOLEAN bst_insert(bst_linked *source, const data_ptr item) {
-	return bst_insert_aux(source, &(source->root), item);
+	int size = 0;
+	return bst_insert_aux(source, &(source->root), item, 0, &size);
+}
+
+// Rebuilds a BST into a balanced shape in place.
+void bst_rebalance(bst_linked *source) {
+	bst_rebuild(source, &source->root);
+	return;
 }
 
 /**
@@ -275,8 +902,10 @@ BOOLEAN bst_retrieve(bst_linked *source, const data_ptr key, data_ptr item) {
 		} else if (comp > 0) {
 			node = node->right;
 		} else {
-			data_copy(item, node->item);
-			retrieved = TRUE;
+			if (!node->deleted) {
+				data_copy(item, node->item);
+				retrieved = TRUE;
+			}
 			break;
 		}
 	}
@@ -284,19 +913,54 @@ BOOLEAN bst_retrieve(bst_linked *source, const data_ptr key, data_ptr item) {
 	return retrieved;
 }
 
-// Removes a value matching key in a BST.
+// Removes a value matching key in a BST by marking its node as a tombstone.
 BOOLEAN bst_remove(bst_linked *source, const data_ptr key, data_ptr item) {
+	bst_node *node = source->root;
+	int comp = 1;
 
-	// your code here
+	while (node != NULL && (comp = data_compare(key, node->item)) != 0) {
+		node = (comp < 0) ? node->left : node->right;
+	}
+	BOOLEAN removed = (node != NULL && !node->deleted);
 
-	return FALSE;
+	if (removed) {
+		data_copy(item, node->item);
+		node->deleted = TRUE;
+		source->count--;
+		source->tombstones++;
+
+		if (source->tombstones > source->tombstone_fraction * source->count) {
+			bst_rebuild(source, &source->root);
+		}
+	}
+	return removed;
 }
 
 // Copies source to target.
 void bst_copy(bst_linked **target, const bst_linked *source) {
-
-	// your code here
-
+	bst_task tasks[2 << BST_FRONTIER_DEPTH];
+	bst_job job;
+	job.tasks = tasks;
+	job.count = 0;
+	int nodes = source->count + source->tombstones;
+	BOOLEAN parallel = (nodes >= BST_PARALLEL_MIN);
+
+	*target = malloc(sizeof **target);
+	**target = *source;
+	(*target)->block = malloc(nodes * (sizeof *job.nodes
+			+ sizeof *source->root->item));
+	(*target)->block_count = nodes;
+	job.nodes = (*target)->block;
+	job.node_items = (data_ptr) (job.nodes + nodes);
+
+	// Size the units, give each a range of slots, then copy them.
+	bst_frontier(source->root, 0, tasks, &job.count);
+	bst_run(&job, bst_task_nodes, parallel);
+	bst_offsets(&job);
+	int index = 0;
+	(*target)->root = bst_copy_top(&job, source->root, 0, &index);
+	bst_run(&job, bst_task_copy, parallel);
+	return;
 }
 
 // Finds the maximum item in a BST.
@@ -315,72 +979,80 @@ BOOLEAN bst_min(const bst_linked *source, data_ptr item) {
 	return FALSE;
 }
 
-/**
- * Finds the number of leaf nodes in a tree.
- *
- * @param source - pointer to a BST
- * @return - count of nodes with no children.
- */
+// Finds the number of leaf nodes in a tree.
 int bst_leaf_count(const bst_linked *source) {
-	bst_node *node = source->root;
-	int count = 0;
-	count = bst_leaf_count_aux(node, count);
-	return count;
+	return (source->child_counts[0]);
 }
 
 // Finds the number of nodes with one child in a tree.
 int bst_one_child_count(const bst_linked *source) {
-
-	// your code here
-
-	return 0;
+	return (source->child_counts[1]);
 }
 
 // Finds the number of nodes with two children in a tree.
 int bst_two_child_count(const bst_linked *source) {
-
-	// your code here
-
-	return 0;
+	return (source->child_counts[2]);
 }
 
 // Determines the number of nodes with zero, one, and two children.
-// (May not call bst_leaf_count, bst_one_child_count, or bst_two_child_count.)
 void bst_node_counts(const bst_linked *source, int *zero, int *one, int *two) {
+	*zero = source->child_counts[0];
+	*one = source->child_counts[1];
+	*two = source->child_counts[2];
+	return;
+}
 
-	// your code here
+// Finds the largest imbalance of any node in a BST.
+int bst_max_imbalance(const bst_linked *source) {
+	int imbalance = BST_MAX_IMBALANCE - 1;
 
-	return;
+	while (imbalance > 0 && source->imbalances[imbalance] == 0) {
+		imbalance--;
+	}
+	return imbalance;
 }
 
-/**
- * Determines whether or not a tree is a balanced tree.
- * All node heights are no more than one greater than any child heights.
- *
- * @param source - pointer to a BST
- * @return - TRUE if source is balanced, FALSE otherwise
- */
+// Determines whether or not a tree is a balanced tree.
 BOOLEAN bst_balanced(const bst_linked *source) {
-	BOOLEAN balanced = TRUE;
-	bst_node *node = source->root;
-	balanced = bst_balanced_aux(node, balanced);
-	return balanced;
+	return (bst_max_imbalance(source) <= 1);
 }
 
 // Determines whether or not a tree is a valid BST.
 BOOLEAN bst_valid(const bst_linked *source) {
-
-// your code here
-
-	return FALSE;
+	bst_linked stats;
+	memset(&stats, 0, sizeof stats);
+	BOOLEAN valid = (bst_valid_aux(&stats, source->root, NULL, NULL) >= 0)
+			&& stats.count == source->count
+			&& stats.tombstones == source->tombstones
+			&& memcmp(stats.child_counts, source->child_counts,
+					sizeof stats.child_counts) == 0
+			&& memcmp(stats.imbalances, source->imbalances,
+					sizeof stats.imbalances) == 0;
+	return valid;
 }
 
 // Determines if two trees contain same data in same configuration.
 BOOLEAN bst_equals(const bst_linked *target, const bst_linked *source) {
-
-// your code here
-
-	return FALSE;
+	bst_task tasks[2 << BST_FRONTIER_DEPTH];
+	bst_job job;
+	job.tasks = tasks;
+	job.count = 0;
+	// The maintained statistics rule out most unequal trees at once.
+	BOOLEAN equals = target->count == source->count
+			&& target->tombstones == source->tombstones
+			&& memcmp(target->child_counts, source->child_counts,
+					sizeof target->child_counts) == 0
+			&& bst_equals_top(target->root, source->root, 0, tasks, &job.count);
+
+	if (equals) {
+		bst_run(&job, bst_task_equals,
+				source->count + source->tombstones >= BST_PARALLEL_MIN);
+
+		for (int i = 0; i < job.count && equals; i++) {
+			equals = tasks[i].result;
+		}
+	}
+	return equals;
 }
 
 /**
@@ -393,7 +1065,9 @@ static void bst_print_aux(bst_node *node) {
 	char string[DATA_STRING_SIZE];
 
 	if (node != NULL) {
-		printf("%s\n", data_string(string, DATA_STRING_SIZE, node->item));
+		if (!node->deleted) {
+			printf("%s\n", data_string(string, DATA_STRING_SIZE, node->item));
+		}
 		bst_print_aux(node->left);
 		bst_print_aux(node->right);
 	}
@@ -18,6 +18,23 @@
 
 #include "data.h"
 
+// An insert that leaves a node deeper than BST_ALPHA * log2(count) edges
+// rebuilds the lowest subtree on its path that is too tall for its size.
+#define BST_ALPHA 1.5
+// Default for tombstone_fraction.
+#define BST_TOMBSTONE_FRACTION 0.25
+// Imbalances tracked one by one; larger ones share the last slot.
+#define BST_MAX_IMBALANCE 64
+// bst_copy, bst_equals and bst_inorder hand the subtrees at this depth to
+// up to BST_THREADS threads, once a tree has BST_PARALLEL_MIN nodes.
+#define BST_THREADS 16
+#define BST_PARALLEL_MIN 65536
+#define BST_FRONTIER_DEPTH 6
+
+// The node statistics (child counts and imbalances) include tombstones,
+// and are kept up to date by every change to the tree, so the queries on
+// them take O(1). bst_valid checks them with a full pass.
+
 // typedefs
 /**
  * BST node
@@ -25,6 +42,7 @@
 typedef struct BST_NODE {
     data_ptr item;           // Pointer to the node data.
     int height;              // Height of the current node.
+    BOOLEAN deleted;         // TRUE if item has been removed (a tombstone).
     struct BST_NODE *left;   // Pointer to the left child.
     struct BST_NODE *right;  // Pointer to the right child.
 } bst_node;
@@ -33,8 +51,14 @@ typedef struct BST_NODE {
  * BST header
  */
 typedef struct {
-    int count;               // Number of nodes in the BST.
+    int count;               // Number of items in the BST, not counting tombstones.
+    int tombstones;          // Number of removed nodes still in the BST.
+    double tombstone_fraction; // Rebuild once tombstones exceed this fraction of count.
+    int child_counts[3];     // Number of nodes with 0, 1 and 2 children.
+    int imbalances[BST_MAX_IMBALANCE]; // Number of nodes by |left height - right height|.
     bst_node *root;          // Pointer to root node of the BST.
+    bst_node *block;         // Nodes allocated together by bst_copy, NULL if none.
+    int block_count;         // Number of nodes in block, followed by their items.
 } bst_linked;
 
 // Prototypes
@@ -78,7 +102,8 @@ BOOLEAN bst_full(const bst_linked *source);
 int bst_count(const bst_linked *source);
 
 /**
- * Inserts a copy of an item into a BST.
+ * Inserts a copy of an item into a BST. If the new node is too deep, the
+ * subtree that makes it so is rebuilt (see BST_ALPHA).
  *
  * @param source - pointer to a BST Pointer to a BST.
  * @param item - pointer to the item to push
@@ -97,7 +122,9 @@ BOOLEAN bst_insert(bst_linked *source, const data_ptr item);
 BOOLEAN bst_retrieve(bst_linked *source, const data_ptr key, data_ptr item);
 
 /**
- * Removes a value matching key in a BST.
+ * Removes a value matching key in a BST. The node stays in place as a
+ * tombstone, so a remove costs the same as a retrieve. Once tombstones
+ * exceed tombstone_fraction of count, the BST is rebuilt without them.
  *
  * @param source - pointer to a BST
  * @param key - key value to search for
@@ -107,15 +134,27 @@ BOOLEAN bst_retrieve(bst_linked *source, const data_ptr key, data_ptr item);
 BOOLEAN bst_remove(bst_linked *source, const data_ptr key, data_ptr item);
 
 /**
- * Copies source to target.
+ * Rebuilds a BST into a balanced shape in place, using the Day-Stout-Warren
+ * algorithm: O(n) time and O(1) extra space besides recomputing heights.
+ * Tombstones are freed in the same pass.
  *
- * @param target - pointer to a BST
+ * @param source - pointer to a BST
+ */
+void bst_rebalance(bst_linked *source);
+
+/**
+ * Copies source to target. The nodes and items of the copy are allocated
+ * as one block, and large trees are copied by several threads.
+ *
+ * @param target - set to a new BST
  * @param source - pointer to a BST
  */
 void bst_copy(bst_linked **target, const bst_linked *source);
 
 /**
- * Copies the contents of a BST to an array in inorder.
+ * Copies the contents of a BST to an array in inorder. Large trees are
+ * split into subtrees whose positions in the array are worked out first,
+ * then filled by several threads.
  *
  * @param source - pointer to a BST
  * @param items - array of items: length must be at least size of BST
@@ -182,7 +221,6 @@ int bst_two_child_count(const bst_linked *source);
 
 /**
  * Determines the number of nodes with zero, one, and two children.
- * (May not call bst_leaf_count, bst_one_child_count, or bst_two_child_count.)
  *
  * @param source - pointer to a BST
  * @param zero - count of leaf nodes (no children)
@@ -191,6 +229,15 @@ int bst_two_child_count(const bst_linked *source);
  */
 void bst_node_counts(const bst_linked *source, int *zero, int *one, int *two);
 
+/**
+ * Finds the largest difference between the heights of the two children
+ * of any node.
+ *
+ * @param source - pointer to a BST
+ * @return - the maximum imbalance, capped at BST_MAX_IMBALANCE - 1
+ */
+int bst_max_imbalance(const bst_linked *source);
+
 /**
  * Determines whether or not a tree is a balanced tree.
  * All node heights are no more than one greater than any child heights.
@@ -201,7 +248,8 @@ void bst_node_counts(const bst_linked *source, int *zero, int *one, int *two);
 BOOLEAN bst_balanced(const bst_linked *source);
 
 /**
- * Determines whether or not a tree is a valid BST.
+ * Determines whether or not a tree is a valid BST, with a full pass that
+ * also checks the heights, counts and node statistics.
  *
  * @param source - pointer to a BST
  * @return - TRUE if source is valid, FALSE otherwise
@@ -209,7 +257,8 @@ BOOLEAN bst_balanced(const bst_linked *source);
 BOOLEAN bst_valid(const bst_linked *source);
 
 /**
- * Determines if two trees contain same data in same configuration.
+ * Determines if two trees contain same data in same configuration,
+ * tombstones included. Large trees are compared by several threads.
  *
  * @param target - pointer to a BST
  * @param source - pointer to a BST
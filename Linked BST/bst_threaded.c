@@ -0,0 +1,371 @@
+/**
+ * -------------------------------------
+ * @file  bst_threaded.c
+ * Threaded BST Source Code File
+ * -------------------------------------
+ * @author Filip Stanojcic
+ *
+ * @version 2026-10-18
+ *
+ */
+// Includes
+#include <stdio.h>
+#include <stdlib.h>
+#include "data.h"
+#include "bst_threaded.h"
+
+//--------------------------------------------------------------------
+// Local Static Helper Functions
+
+/**
+ * Initializes a new threaded BST node with a copy of item.
+ *
+ * @param item - pointer to the item to assign to the node
+ * @param left - the node's predecessor
+ * @param right - the node's successor
+ * @return a pointer to a new threaded BST node
+ */
+static bst_threaded_node* bst_threaded_node_initialize(const data_ptr item,
+		bst_threaded_node *left, bst_threaded_node *right) {
+	bst_threaded_node *node = malloc(sizeof *node);
+	node->item = malloc(sizeof *node->item);
+	data_copy(node->item, item);
+	// A new node is a leaf: both links are threads.
+	node->left_thread = TRUE;
+	node->right_thread = TRUE;
+	node->left = left;
+	node->right = right;
+	return node;
+}
+
+/**
+ * Returns the leftmost node of a subtree.
+ *
+ * @param node - root of a non-empty subtree
+ * @return the leftmost node
+ */
+static bst_threaded_node* bst_threaded_leftmost(bst_threaded_node *node) {
+
+	while (!node->left_thread) {
+		node = node->left;
+	}
+	return node;
+}
+
+/**
+ * Returns the rightmost node of a subtree.
+ *
+ * @param node - root of a non-empty subtree
+ * @return the rightmost node
+ */
+static bst_threaded_node* bst_threaded_rightmost(bst_threaded_node *node) {
+
+	while (!node->right_thread) {
+		node = node->right;
+	}
+	return node;
+}
+
+/**
+ * Unlinks a node with at most one child from a threaded BST, and moves the
+ * threads that pointed to it on to its predecessor or successor.
+ *
+ * @param source - pointer to a threaded BST
+ * @param parent - parent of node, NULL if node is the root
+ * @param node - the node to unlink
+ */
+static void bst_threaded_unlink(bst_threaded *source,
+		bst_threaded_node *parent, bst_threaded_node *node) {
+	BOOLEAN left_child = (parent != NULL && !parent->left_thread
+			&& parent->left == node);
+
+	if (node->left_thread && node->right_thread) {
+		// A leaf: the parent's link to it becomes a thread past it.
+		if (parent == NULL) {
+			source->root = NULL;
+		} else if (left_child) {
+			parent->left = node->left;
+			parent->left_thread = TRUE;
+		} else {
+			parent->right = node->right;
+			parent->right_thread = TRUE;
+		}
+	} else {
+		bst_threaded_node *child = NULL;
+
+		// The only thread that points to node comes from the nearest node
+		// of its subtree.
+		if (!node->left_thread) {
+			child = node->left;
+			bst_threaded_rightmost(child)->right = node->right;
+		} else {
+			child = node->right;
+			bst_threaded_leftmost(child)->left = node->left;
+		}
+		if (parent == NULL) {
+			source->root = child;
+		} else if (left_child) {
+			parent->left = child;
+		} else {
+			parent->right = child;
+		}
+	}
+	return;
+}
+
+//--------------------------------------------------------------------
+// Functions
+
+// Initializes a threaded BST.
+bst_threaded* bst_threaded_initialize() {
+	bst_threaded *source = malloc(sizeof *source);
+	source->count = 0;
+	source->root = NULL;
+	return source;
+}
+
+// Frees all parts of a threaded BST.
+void bst_threaded_free(bst_threaded **source) {
+	bst_threaded_node *node = NULL;
+
+	if ((*source)->root != NULL) {
+		node = bst_threaded_leftmost((*source)->root);
+	}
+	// The successor of a node is found before the node is freed, and never
+	// passes through a node already freed.
+	while (node != NULL) {
+		bst_threaded_node *next = (bst_threaded_node*) bst_threaded_next(node);
+		data_free(&node->item);
+		free(node);
+		node = next;
+	}
+	(*source)->root = NULL;
+	free(*source);
+	*source = NULL;
+	return;
+}
+
+// Determines if a threaded BST is empty.
+BOOLEAN bst_threaded_empty(const bst_threaded *source) {
+	return (source->root == NULL);
+}
+
+// Determines if a threaded BST is full.
+BOOLEAN bst_threaded_full(const bst_threaded *source) {
+	return FALSE;
+}
+
+// Returns number of items in a threaded BST.
+int bst_threaded_count(const bst_threaded *source) {
+	return source->count;
+}
+
+// Inserts a copy of an item into a threaded BST.
+BOOLEAN bst_threaded_insert(bst_threaded *source, const data_ptr item) {
+	bst_threaded_node *node = source->root;
+	BOOLEAN inserted = FALSE;
+
+	if (node == NULL) {
+		source->root = bst_threaded_node_initialize(item, NULL, NULL);
+		inserted = TRUE;
+	}
+	while (!inserted && node != NULL) {
+		int comp = data_compare(item, node->item);
+
+		if (comp < 0 && !node->left_thread) {
+			node = node->left;
+		} else if (comp < 0) {
+			// The new node falls between node's predecessor and node.
+			node->left = bst_threaded_node_initialize(item, node->left, node);
+			node->left_thread = FALSE;
+			inserted = TRUE;
+		} else if (comp > 0 && !node->right_thread) {
+			node = node->right;
+		} else if (comp > 0) {
+			// The new node falls between node and its successor.
+			node->right = bst_threaded_node_initialize(item, node, node->right);
+			node->right_thread = FALSE;
+			inserted = TRUE;
+		} else {
+			// Item is already in the BST.
+			node = NULL;
+		}
+	}
+	if (inserted) {
+		source->count++;
+	}
+	return inserted;
+}
+
+// Retrieves a copy of a value matching key in a threaded BST.
+BOOLEAN bst_threaded_retrieve(const bst_threaded *source, const data_ptr key,
+		data_ptr item) {
+	const bst_threaded_node *node = bst_threaded_find(source, key);
+
+	if (node != NULL) {
+		data_copy(item, node->item);
+	}
+	return (node != NULL);
+}
+
+// Removes a value matching key in a threaded BST.
+BOOLEAN bst_threaded_remove(bst_threaded *source, const data_ptr key,
+		data_ptr item) {
+	bst_threaded_node *parent = NULL;
+	bst_threaded_node *node = source->root;
+	int comp = 1;
+
+	while (node != NULL && (comp = data_compare(key, node->item)) != 0) {
+		parent = node;
+
+		if (comp < 0) {
+			node = node->left_thread ? NULL : node->left;
+		} else {
+			node = node->right_thread ? NULL : node->right;
+		}
+	}
+	if (node != NULL) {
+		data_copy(item, node->item);
+
+		if (!node->left_thread && !node->right_thread) {
+			// Two children: unlink the successor, which has no left child,
+			// and move its node into node's place, so no other node moves.
+			bst_threaded_node *successor = node->right;
+			bst_threaded_node *successor_parent = node;
+
+			while (!successor->left_thread) {
+				successor_parent = successor;
+				successor = successor->left;
+			}
+			bst_threaded_unlink(source, successor_parent, successor);
+			successor->left = node->left;
+			successor->left_thread = FALSE;
+			successor->right = node->right;
+			successor->right_thread = node->right_thread;
+			// The threads that pointed to node now point to its
+			// replacement.
+			bst_threaded_rightmost(successor->left)->right = successor;
+
+			if (!successor->right_thread) {
+				bst_threaded_leftmost(successor->right)->left = successor;
+			}
+			if (parent == NULL) {
+				source->root = successor;
+			} else if (!parent->left_thread && parent->left == node) {
+				parent->left = successor;
+			} else {
+				parent->right = successor;
+			}
+		} else {
+			bst_threaded_unlink(source, parent, node);
+		}
+		data_free(&node->item);
+		free(node);
+		source->count--;
+	}
+	return (node != NULL);
+}
+
+// Finds the node holding key.
+const bst_threaded_node* bst_threaded_find(const bst_threaded *source,
+		const data_ptr key) {
+	const bst_threaded_node *node = source->root;
+	int comp = 1;
+
+	while (node != NULL && (comp = data_compare(key, node->item)) != 0) {
+		if (comp < 0) {
+			node = node->left_thread ? NULL : node->left;
+		} else {
+			node = node->right_thread ? NULL : node->right;
+		}
+	}
+	return node;
+}
+
+// Returns the node with the smallest item.
+const bst_threaded_node* bst_threaded_first(const bst_threaded *source) {
+	const bst_threaded_node *node = NULL;
+
+	if (source->root != NULL) {
+		node = bst_threaded_leftmost(source->root);
+	}
+	return node;
+}
+
+// Returns the node with the largest item.
+const bst_threaded_node* bst_threaded_last(const bst_threaded *source) {
+	const bst_threaded_node *node = NULL;
+
+	if (source->root != NULL) {
+		node = bst_threaded_rightmost(source->root);
+	}
+	return node;
+}
+
+// Returns the inorder successor of a node.
+const bst_threaded_node* bst_threaded_next(const bst_threaded_node *node) {
+	const bst_threaded_node *next = node->right;
+
+	if (!node->right_thread) {
+		next = bst_threaded_leftmost(node->right);
+	}
+	return next;
+}
+
+// Returns the inorder predecessor of a node.
+const bst_threaded_node* bst_threaded_prev(const bst_threaded_node *node) {
+	const bst_threaded_node *prev = node->left;
+
+	if (!node->left_thread) {
+		prev = bst_threaded_rightmost(node->left);
+	}
+	return prev;
+}
+
+// Copies the contents of a threaded BST to an array in inorder.
+void bst_threaded_inorder(const bst_threaded *source, data_ptr *items) {
+	const bst_threaded_node *node = bst_threaded_first(source);
+	int index = 0;
+
+	while (node != NULL) {
+		items[index] = node->item;
+		index++;
+		node = bst_threaded_next(node);
+	}
+	return;
+}
+
+// Determines whether or not a threaded BST is valid.
+BOOLEAN bst_threaded_valid(const bst_threaded *source) {
+	const bst_threaded_node *prev = NULL;
+	const bst_threaded_node *node = bst_threaded_first(source);
+	int count = 0;
+	BOOLEAN valid = TRUE;
+
+	// Stop after count + 1 nodes in case the threads form a cycle.
+	while (valid && node != NULL && count <= source->count) {
+		valid = (!node->left_thread || node->left == prev)
+				&& (prev == NULL || !prev->right_thread || prev->right == node)
+				&& (prev == NULL || data_compare(prev->item, node->item) < 0);
+		count++;
+		prev = node;
+		node = bst_threaded_next(node);
+	}
+	return valid && count == source->count
+			&& (prev == NULL || (prev->right_thread && prev->right == NULL));
+}
+
+// Prints the items in a threaded BST in inorder.
+void bst_threaded_print(const bst_threaded *source) {
+	char string[DATA_STRING_SIZE];
+	const bst_threaded_node *node = bst_threaded_first(source);
+
+	printf("  count: %d, items:\n", source->count);
+
+	while (node != NULL) {
+		printf("%s\n", data_string(string, DATA_STRING_SIZE, node->item));
+		node = bst_threaded_next(node);
+	}
+	printf("\n");
+	return;
+}
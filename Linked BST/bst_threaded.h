@@ -0,0 +1,185 @@
+/**
+ * -------------------------------------
+ * @file  bst_threaded.h
+ * Threaded BST Header File
+ * -------------------------------------
+ * @author Filip Stanojcic
+ *
+ * @version 2026-10-18
+ *
+ * A BST in which a missing left child is replaced by a thread to the
+ * node's inorder predecessor, and a missing right child by a thread to its
+ * inorder successor. The first and last nodes have NULL threads. Threads
+ * are kept correct by insert and remove, so the nodes can be scanned in
+ * order without a stack or recursion, starting from any node, in O(1)
+ * amortized time per step. Remove frees only the node that held the key,
+ * so pointers to every other node stay valid.
+ */
+#ifndef BST_THREADED_H_
+#define BST_THREADED_H_
+
+// Includes
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "data.h"
+
+// typedefs
+/**
+ * Threaded BST node
+ */
+typedef struct BST_THREADED_NODE {
+    data_ptr item;           // Pointer to the node data.
+    BOOLEAN left_thread;     // TRUE if left is a thread to the predecessor.
+    BOOLEAN right_thread;    // TRUE if right is a thread to the successor.
+    struct BST_THREADED_NODE *left;  // Pointer to the left child or predecessor.
+    struct BST_THREADED_NODE *right; // Pointer to the right child or successor.
+} bst_threaded_node;
+
+/**
+ * Threaded BST header
+ */
+typedef struct {
+    int count;               // Number of nodes in the BST.
+    bst_threaded_node *root; // Pointer to root node of the BST.
+} bst_threaded;
+
+// Prototypes
+
+/**
+ * Initializes a threaded BST.
+ *
+ * @return pointer to a threaded BST
+ */
+bst_threaded* bst_threaded_initialize();
+
+/**
+ * Frees all parts of a threaded BST.
+ *
+ * @param source - pointer to a threaded BST
+ */
+void bst_threaded_free(bst_threaded **source);
+
+/**
+ * Determines if a threaded BST is empty.
+ *
+ * @param source - pointer to a threaded BST
+ * @return TRUE if the BST is empty, FALSE otherwise
+ */
+BOOLEAN bst_threaded_empty(const bst_threaded *source);
+
+/**
+ * Determines if a threaded BST is full.
+ *
+ * @param source - pointer to a threaded BST
+ * @return - TRUE if the BST is full, FALSE otherwise
+ */
+BOOLEAN bst_threaded_full(const bst_threaded *source);
+
+/**
+ * Returns number of items in a threaded BST.
+ *
+ * @param source - pointer to a threaded BST
+ * @return - number of items in BST
+ */
+int bst_threaded_count(const bst_threaded *source);
+
+/**
+ * Inserts a copy of an item into a threaded BST.
+ *
+ * @param source - pointer to a threaded BST
+ * @param item - pointer to the item to insert
+ * @return - TRUE if item inserted, FALSE otherwise
+ */
+BOOLEAN bst_threaded_insert(bst_threaded *source, const data_ptr item);
+
+/**
+ * Retrieves a copy of a value matching key in a threaded BST.
+ *
+ * @param source - pointer to a threaded BST
+ * @param key - key value to search for
+ * @param item - pointer to copy of the item retrieved
+ * @return - TRUE if item retrieved, FALSE otherwise (key not found)
+ */
+BOOLEAN bst_threaded_retrieve(const bst_threaded *source, const data_ptr key,
+        data_ptr item);
+
+/**
+ * Removes a value matching key in a threaded BST.
+ *
+ * @param source - pointer to a threaded BST
+ * @param key - key value to search for
+ * @param item - pointer to the item removed
+ * @return - TRUE if item removed, FALSE otherwise (key not found)
+ */
+BOOLEAN bst_threaded_remove(bst_threaded *source, const data_ptr key,
+        data_ptr item);
+
+/**
+ * Finds the node holding key, to start a scan from.
+ *
+ * @param source - pointer to a threaded BST
+ * @param key - key value to search for
+ * @return - pointer to the node, NULL if key not found
+ */
+const bst_threaded_node* bst_threaded_find(const bst_threaded *source,
+        const data_ptr key);
+
+/**
+ * Returns the node with the smallest item.
+ *
+ * @param source - pointer to a threaded BST
+ * @return - pointer to the node, NULL if the BST is empty
+ */
+const bst_threaded_node* bst_threaded_first(const bst_threaded *source);
+
+/**
+ * Returns the node with the largest item.
+ *
+ * @param source - pointer to a threaded BST
+ * @return - pointer to the node, NULL if the BST is empty
+ */
+const bst_threaded_node* bst_threaded_last(const bst_threaded *source);
+
+/**
+ * Returns the inorder successor of a node. O(1) amortized over a scan.
+ *
+ * @param node - pointer to a node of a threaded BST
+ * @return - pointer to the next node, NULL if node is the last
+ */
+const bst_threaded_node* bst_threaded_next(const bst_threaded_node *node);
+
+/**
+ * Returns the inorder predecessor of a node. O(1) amortized over a scan.
+ *
+ * @param node - pointer to a node of a threaded BST
+ * @return - pointer to the previous node, NULL if node is the first
+ */
+const bst_threaded_node* bst_threaded_prev(const bst_threaded_node *node);
+
+/**
+ * Copies the contents of a threaded BST to an array in inorder.
+ *
+ * @param source - pointer to a threaded BST
+ * @param items - array of items: length must be at least size of BST
+ */
+void bst_threaded_inorder(const bst_threaded *source, data_ptr *items);
+
+/**
+ * Determines whether or not a threaded BST is valid: items in order,
+ * every thread pointing to the node's predecessor or successor, and count
+ * correct.
+ *
+ * @param source - pointer to a threaded BST
+ * @return - TRUE if source is valid, FALSE otherwise
+ */
+BOOLEAN bst_threaded_valid(const bst_threaded *source);
+
+/**
+ * Prints the items in a threaded BST in inorder.
+ *
+ * @param source - pointer to a threaded BST
+ */
+void bst_threaded_print(const bst_threaded *source);
+
+#endif /* BST_THREADED_H_ */
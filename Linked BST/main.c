@@ -7,12 +7,16 @@
  *
  * @version 2024-03-01
  *
+ * bst_copy, bst_equals and bst_inorder use POSIX threads, so build with:
+ *   gcc -O2 -pthread *.c
  */
 #include <stdio.h>
 #include <stdlib.h>
+#include <time.h>
 
 #include "data.h"
 #include "bst_linked.h"
+#include "bst_threaded.h"
 
 /**
  * Simple BST testing.
@@ -44,6 +48,13 @@ void test_bst(void) {
     printf("count: %d\n", bst_count(source));
     printf("leaf_count: %d\n", bst_leaf_count(source));
     printf("balanced: %s\n", BOOL_TO_STR(bst_balanced(source)));
+    int zero = 0;
+    int one = 0;
+    int two = 0;
+    bst_node_counts(source, &zero, &one, &two);
+    printf("node counts: %d, %d, %d, max imbalance: %d\n", zero, one, two,
+            bst_max_imbalance(source));
+    printf("valid: %s\n", BOOL_TO_STR(bst_valid(source)));
     data_ptr values[count];
     printf("inorder:   {");
     bst_inorder(source, values);
@@ -68,6 +79,175 @@ void test_bst(void) {
     bst_free(&source);
 }
 
+/**
+ * Inserts keys in order, which would leave an unbalanced BST as a linked
+ * list, and shows the height kept down by partial rebuilds.
+ */
+void test_bst_rebuild(void) {
+    int keys = 100000;
+    bst_linked *source = bst_initialize();
+    clock_t start = clock();
+
+    for(int i = 0; i < keys; i++) {
+        bst_insert(source, &i);
+    }
+    double seconds = (double) (clock() - start) / CLOCKS_PER_SEC;
+    printf("%d sorted inserts: %.3fs, height: %d\n", bst_count(source), seconds,
+            source->root->height);
+    bst_rebalance(source);
+    printf("after bst_rebalance height: %d, balanced: %s\n",
+            source->root->height, BOOL_TO_STR(bst_balanced(source)));
+    bst_free(&source);
+}
+
+/**
+ * Removes keys until the tombstones left behind trigger a rebuild.
+ */
+void test_bst_tombstones(void) {
+    int keys = 1000;
+    bst_linked *source = bst_initialize();
+    int item = 0;
+
+    for(int i = 0; i < keys; i++) {
+        bst_insert(source, &i);
+    }
+    for(int i = 0; i < keys; i += 5) {
+        bst_remove(source, &i, &item);
+    }
+    printf("count: %d, tombstones: %d\n", bst_count(source), source->tombstones);
+    int key = 1;
+    bst_remove(source, &key, &item);
+    printf("count: %d, tombstones: %d after one more remove\n",
+            bst_count(source), source->tombstones);
+    printf("retrieve %d: %s\n", key,
+            BOOL_TO_STR(bst_retrieve(source, &key, &item)));
+    bst_free(&source);
+}
+
+/**
+ * Returns wall clock time, which unlike clock() does not add up the time
+ * of every thread.
+ *
+ * @return - seconds
+ */
+static double wall_time(void) {
+    struct timespec now;
+    timespec_get(&now, TIME_UTC);
+    return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+/**
+ * Copies a large BST, compares the copy with the original and lists it
+ * in inorder, each of which is split across threads.
+ */
+void test_bst_copy(void) {
+    int keys = 1000000;
+    bst_linked *source = bst_initialize();
+    bst_linked *target = NULL;
+    data_ptr *values = malloc(keys * sizeof *values);
+    int item = 0;
+
+    for(int i = 0; i < keys; i++) {
+        int key = (int) ((i * 2654435761u) % keys);
+        bst_insert(source, &key);
+    }
+    for(int i = 0; i < keys; i += 7) {
+        bst_remove(source, &i, &item);
+    }
+    double start = wall_time();
+    bst_copy(&target, source);
+    double copy_time = wall_time() - start;
+    start = wall_time();
+    BOOLEAN equals = bst_equals(target, source);
+    double equals_time = wall_time() - start;
+    start = wall_time();
+    bst_inorder(target, values);
+    double inorder_time = wall_time() - start;
+    printf("%d items: copy %.3fs, equals %.3fs (%s), inorder %.3fs\n",
+            bst_count(target), copy_time, equals_time, BOOL_TO_STR(equals),
+            inorder_time);
+    int key = 1;
+    bst_remove(target, &key, &item);
+    printf("after remove from copy equals: %s, valid: %s\n",
+            BOOL_TO_STR(bst_equals(target, source)),
+            BOOL_TO_STR(bst_valid(target)));
+    free(values);
+    bst_free(&target);
+    bst_free(&source);
+}
+
+/**
+ * Scans a threaded BST forwards from a key and backwards from its end, and
+ * times a full scan against materializing a bst_linked with bst_inorder.
+ */
+void test_bst_threaded(void) {
+    int numbers[] = {11, 7, 6, 9, 8, 15, 12, 18};
+    int count = sizeof numbers / sizeof *numbers;
+    bst_threaded *source = bst_threaded_initialize();
+
+    for(int i = 0; i < count; i++) {
+        bst_threaded_insert(source, &numbers[i]);
+    }
+    int key = 9;
+    printf("from %d:  {", key);
+
+    for(const bst_threaded_node *node = bst_threaded_find(source, &key);
+            node != NULL; node = bst_threaded_next(node)) {
+        printf("%d, ", *node->item);
+    }
+    printf("}\n");
+    // 12 is the successor of 11, which has two children: its node must
+    // stay where the cursor points.
+    key = 12;
+    const bst_threaded_node *cursor = bst_threaded_find(source, &key);
+    int item = 0;
+    bst_threaded_remove(source, &numbers[0], &item);
+    printf("  removed: %d\n", item);
+    printf("   cursor: %d, next %d\n", *cursor->item,
+            *bst_threaded_next(cursor)->item);
+    printf("reversed: {");
+
+    for(const bst_threaded_node *node = bst_threaded_last(source);
+            node != NULL; node = bst_threaded_prev(node)) {
+        printf("%d, ", *node->item);
+    }
+    printf("}\n");
+    printf("valid: %s\n", BOOL_TO_STR(bst_threaded_valid(source)));
+    bst_threaded_free(&source);
+
+    int keys = 1000000;
+    bst_linked *linked = bst_initialize();
+    source = bst_threaded_initialize();
+    data_ptr *values = malloc(keys * sizeof *values);
+
+    for(int i = 0; i < keys; i++) {
+        key = (int) ((i * 2654435761u) % keys);
+        bst_insert(linked, &key);
+        bst_threaded_insert(source, &key);
+    }
+    double start = wall_time();
+    long sum = 0;
+
+    for(const bst_threaded_node *node = bst_threaded_first(source);
+            node != NULL; node = bst_threaded_next(node)) {
+        sum += *node->item;
+    }
+    double threaded_time = wall_time() - start;
+    start = wall_time();
+    bst_inorder(linked, values);
+
+    for(int i = 0; i < bst_count(linked); i++) {
+        sum -= *values[i];
+    }
+    double inorder_time = wall_time() - start;
+    printf("%d items: threaded scan %.3fs, bst_inorder scan %.3fs (%s)\n",
+            bst_threaded_count(source), threaded_time, inorder_time,
+            sum == 0 ? "same items" : "different items");
+    free(values);
+    bst_free(&linked);
+    bst_threaded_free(&source);
+}
+
 /**
  * Test the file and string functions.
  *
@@ -79,6 +259,10 @@ int main(int argc, char *argv[]) {
     setbuf(stdout, NULL);
 
     test_bst();
+    test_bst_rebuild();
+    test_bst_tombstones();
+    test_bst_copy();
+    test_bst_threaded();
 
     return (EXIT_SUCCESS);
 }
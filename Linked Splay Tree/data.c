@@ -0,0 +1,51 @@
+/**
+ * -------------------------------------
+ * @file  data.c
+ * Data Type Source Code File
+ * -------------------------------------
+ * @author Filip Stanojcic
+ *
+ * @version 2024-02-22
+ *
+ */
+// Includes
+#include <stdio.h>
+
+#include "data.h"
+
+// Functions
+
+char* data_string(char *string, size_t size, data_ptr data) {
+    snprintf(string, size, "%d", *data);
+    return string;
+}
+
+void data_copy(data_ptr target, data_ptr source) {
+    *target = *source;
+}
+
+int data_compare(data_ptr source, data_ptr target) {
+    int result = 0;
+
+    if(*source < *target) {
+        result = -1;
+    } else if(*source > *target) {
+        result = 1;
+    }
+    return (result);
+}
+
+unsigned long long data_hash(data_ptr source) {
+    // splitmix64 finalizer
+    unsigned long long hash = (unsigned int) *source;
+
+    hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebULL;
+    return (hash ^ (hash >> 31));
+}
+
+void data_free(data_ptr *source) {
+    free(*source);
+    *source = NULL;
+    return;
+}
@@ -0,0 +1,216 @@
+/**
+ * -------------------------------------
+ * @file  main.c
+ * Main Source Code File
+ * -------------------------------------
+ * @author Filip Stanojcic
+ *
+ * @version 2026-10-18
+ *
+ * The benchmark compares against the Linked AVL tree, so build with:
+ *   gcc -O2 *.c "../Linked AVL/avl_linked.c" -lm
+ */
+// Includes
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+
+#include "data.h"
+#include "splay_linked.h"
+#include "../Linked AVL/avl_linked.h"
+
+#define SORTED_COUNT 1000000  // Keys inserted in order by test_splay
+#define BENCH_KEYS 100000     // Keys in each tree
+#define BENCH_LOOKUPS 2000000 // Lookups per access trace
+#define BENCH_ZIPF 0.99       // Zipf exponent
+
+/**
+ * Returns a pseudo-random number (xorshift).
+ *
+ * @param seed - state, updated
+ * @return - next number
+ */
+static unsigned int bench_random(unsigned int *seed) {
+    *seed ^= *seed << 13;
+    *seed ^= *seed >> 17;
+    *seed ^= *seed << 5;
+    return *seed;
+}
+
+/**
+ * Fills trace with keys drawn from a Zipf distribution over ranks
+ * 1..BENCH_KEYS. Ranks are mapped to keys through a random permutation, so
+ * the popular keys are scattered through the key range.
+ *
+ * @param trace - array of BENCH_LOOKUPS keys
+ */
+static void bench_zipf_trace(int *trace) {
+    double *cdf = malloc(BENCH_KEYS * sizeof *cdf);
+    int *keys = malloc(BENCH_KEYS * sizeof *keys);
+    unsigned int seed = 7;
+    double total = 0;
+
+    for(int i = 0; i < BENCH_KEYS; i++) {
+        total += 1 / pow(i + 1, BENCH_ZIPF);
+        cdf[i] = total;
+        keys[i] = i;
+    }
+    for(int i = BENCH_KEYS - 1; i > 0; i--) {
+        int j = bench_random(&seed) % (i + 1);
+        int temp = keys[i];
+        keys[i] = keys[j];
+        keys[j] = temp;
+    }
+    for(int i = 0; i < BENCH_LOOKUPS; i++) {
+        double u = (double) bench_random(&seed) / 4294967296.0 * total;
+        int low = 0;
+        int high = BENCH_KEYS - 1;
+
+        while (low < high) {
+            int middle = (low + high) / 2;
+
+            if (cdf[middle] < u) {
+                low = middle + 1;
+            } else {
+                high = middle;
+            }
+        }
+        trace[i] = keys[low];
+    }
+    free(keys);
+    free(cdf);
+}
+
+/**
+ * Simple splay tree testing.
+ */
+void test_splay(void) {
+    int numbers[] = {11, 7, 6, 9, 8, 15, 12, 18};
+    int count = sizeof numbers / sizeof *numbers;
+    data_ptr values[count];
+    splay_linked *source = splay_initialize();
+
+    for(int i = 0; i < count; i++) {
+        splay_insert(source, &numbers[i]);
+    }
+    splay_print(source);
+    int item = 0;
+    int key = 9;
+    BOOLEAN retrieved = splay_retrieve(source, &key, &item);
+    printf("retrieve %d: %s, new root: %d\n", key, BOOL_TO_STR(retrieved),
+            *source->root->item);
+    printf("valid: %s\n", BOOL_TO_STR(splay_valid(source)));
+    splay_remove(source, &numbers[0], &item);
+    printf("  removed: %d\n", item);
+    printf("inorder:  {");
+    splay_inorder(source, values);
+
+    for(int i = 0; i < splay_count(source); i++) {
+        printf("%d, ", *values[i]);
+    }
+    printf("}\n");
+    splay_free(&source);
+
+    // Sorted inserts leave a path as deep as the tree is large, which the
+    // whole-tree functions must walk without recursing.
+    source = splay_initialize();
+
+    for(int i = 0; i < SORTED_COUNT; i++) {
+        splay_insert(source, &i);
+    }
+    splay_linked *copy = NULL;
+    splay_copy(&copy, source);
+    printf("%d sorted: valid %s, balanced %s, copy equal %s\n", SORTED_COUNT,
+            BOOL_TO_STR(splay_valid(source)),
+            BOOL_TO_STR(splay_balanced(source)),
+            BOOL_TO_STR(splay_equals(copy, source)));
+    splay_free(&copy);
+    splay_free(&source);
+}
+
+/**
+ * Times one access trace on a splay tree and an AVL with the same keys.
+ *
+ * @param name - name of the trace
+ * @param trace - array of BENCH_LOOKUPS keys
+ */
+static void bench_splay_trace(const char *name, const int *trace) {
+    splay_linked *splay = splay_initialize();
+    avl_linked *avl = avl_initialize();
+    unsigned int seed = 3;
+    int *keys = malloc(BENCH_KEYS * sizeof *keys);
+
+    // Insert in random order so neither tree starts from a special shape.
+    for(int i = 0; i < BENCH_KEYS; i++) {
+        keys[i] = i;
+    }
+    for(int i = BENCH_KEYS - 1; i > 0; i--) {
+        int j = bench_random(&seed) % (i + 1);
+        int temp = keys[i];
+        keys[i] = keys[j];
+        keys[j] = temp;
+    }
+    for(int i = 0; i < BENCH_KEYS; i++) {
+        splay_insert(splay, &keys[i]);
+        avl_insert(avl, &keys[i]);
+    }
+    int item = 0;
+    clock_t start = clock();
+
+    for(int i = 0; i < BENCH_LOOKUPS; i++) {
+        splay_retrieve(splay, (data_ptr) &trace[i], &item);
+    }
+    double splay_time = (double) (clock() - start) / CLOCKS_PER_SEC;
+    start = clock();
+
+    for(int i = 0; i < BENCH_LOOKUPS; i++) {
+        avl_retrieve(avl, (data_ptr) &trace[i], &item);
+    }
+    double avl_time = (double) (clock() - start) / CLOCKS_PER_SEC;
+    printf("%-10s  %8.3f  %8.3f\n", name, splay_time, avl_time);
+    free(keys);
+    avl_free(&avl);
+    splay_free(&splay);
+}
+
+/**
+ * Compares splay_retrieve with avl_retrieve on uniform, Zipf and
+ * sequential access traces.
+ */
+void bench_splay(void) {
+    int *trace = malloc(BENCH_LOOKUPS * sizeof *trace);
+    unsigned int seed = 5;
+
+    printf("%d lookups over %d keys (seconds)\n", BENCH_LOOKUPS, BENCH_KEYS);
+    printf("trace          splay       avl\n");
+
+    for(int i = 0; i < BENCH_LOOKUPS; i++) {
+        trace[i] = bench_random(&seed) % BENCH_KEYS;
+    }
+    bench_splay_trace("uniform", trace);
+    bench_zipf_trace(trace);
+    bench_splay_trace("zipf", trace);
+
+    for(int i = 0; i < BENCH_LOOKUPS; i++) {
+        trace[i] = i % BENCH_KEYS;
+    }
+    bench_splay_trace("sequential", trace);
+    free(trace);
+}
+
+/**
+ * Test the splay tree functions.
+ *
+ * @param argc - unused
+ * @param argv - unused
+ * @return EXIT_SUCCESS
+ */
+int main(int argc, char *argv[]) {
+    setbuf(stdout, NULL);
+
+    test_splay();
+    bench_splay();
+
+    return (EXIT_SUCCESS);
+}
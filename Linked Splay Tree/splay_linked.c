@@ -0,0 +1,678 @@
+/**
+ * -------------------------------------
+ * @file  splay_linked.c
+ * Linked Splay Tree Source Code File
+ * -------------------------------------
+ * @author Filip Stanojcic
+ *
+ * @version 2026-10-18
+ *
+ */
+// Includes
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "splay_linked.h"
+
+//--------------------------------------------------------------------
+// Local Static Helper Functions
+
+/**
+ * Initializes a new splay tree node with a copy of item.
+ *
+ * @param item - pointer to the item to assign to the node
+ * @return a pointer to a new splay tree node
+ */
+static splay_node* splay_node_initialize(const data_ptr item) {
+	splay_node *node = malloc(sizeof *node);
+	node->item = malloc(sizeof *node->item);
+	data_copy(node->item, item);
+	node->left = NULL;
+	node->right = NULL;
+	return node;
+}
+
+/**
+ * Top-down splay: moves the node matching key, or the last node on its
+ * search path, to the root of a subtree. Nodes passed on the way down are
+ * hung off a left tree (smaller than key) and a right tree (larger than
+ * key), two at a time with a rotation on zig-zig steps, and the three
+ * trees are joined at the end. Uses no stack and no parent links.
+ *
+ * @param node - root of the subtree
+ * @param key - key value to search for
+ * @return the new root of the subtree
+ */
+static splay_node* splay_aux(splay_node *node, const data_ptr key) {
+
+	if (node != NULL) {
+		// header.right is the left tree, header.left the right tree.
+		splay_node header;
+		header.left = NULL;
+		header.right = NULL;
+		splay_node *left_max = &header;
+		splay_node *right_min = &header;
+		BOOLEAN done = FALSE;
+
+		while (!done) {
+			int comp = data_compare(key, node->item);
+
+			if (comp < 0 && node->left != NULL) {
+				if (data_compare(key, node->left->item) < 0) {
+					// Zig-zig: rotate right.
+					splay_node *temp = node->left;
+					node->left = temp->right;
+					temp->right = node;
+					node = temp;
+				}
+				if (node->left == NULL) {
+					done = TRUE;
+				} else {
+					// Link right.
+					right_min->left = node;
+					right_min = node;
+					node = node->left;
+				}
+			} else if (comp > 0 && node->right != NULL) {
+				if (data_compare(key, node->right->item) > 0) {
+					// Zag-zag: rotate left.
+					splay_node *temp = node->right;
+					node->right = temp->left;
+					temp->left = node;
+					node = temp;
+				}
+				if (node->right == NULL) {
+					done = TRUE;
+				} else {
+					// Link left.
+					left_max->right = node;
+					left_max = node;
+					node = node->right;
+				}
+			} else {
+				done = TRUE;
+			}
+		}
+		// Assemble.
+		left_max->right = node->left;
+		right_min->left = node->right;
+		node->left = header.right;
+		node->right = header.left;
+	}
+	return node;
+}
+
+/**
+ * Frees a node and its children. Each left child is rotated up until the
+ * node has none, and the node is then freed and its right child taken
+ * next: the tree is unrolled into a list as it goes, so needs no stack
+ * however deep it is.
+ *
+ * @param node - The node to process
+ */
+static void splay_free_aux(splay_node *node) {
+
+	while (node != NULL) {
+
+		if (node->left != NULL) {
+			splay_node *left = node->left;
+			node->left = left->right;
+			left->right = node;
+			node = left;
+		} else {
+			splay_node *right = node->right;
+			data_free(&node->item);
+			free(node);
+			node = right;
+		}
+	}
+	return;
+}
+
+/**
+ * Copies a node and its children in preorder. A stack holds the nodes
+ * still to copy with the links their copies go in, since a splay tree can
+ * be as deep as it has nodes.
+ *
+ * @param node - The node to copy
+ * @param count - number of nodes below node
+ * @return a pointer to the copy
+ */
+static splay_node* splay_copy_aux(const splay_node *node, int count) {
+	splay_node *copy = NULL;
+	const splay_node **nodes = malloc(count * sizeof *nodes);
+	splay_node ***links = malloc(count * sizeof *links);
+	int top = 0;
+
+	if (node != NULL) {
+		nodes[top] = node;
+		links[top] = &copy;
+		top++;
+	}
+	while (top > 0) {
+		top--;
+		node = nodes[top];
+		splay_node *new_node = splay_node_initialize(node->item);
+		*links[top] = new_node;
+
+		if (node->right != NULL) {
+			nodes[top] = node->right;
+			links[top] = &new_node->right;
+			top++;
+		}
+		if (node->left != NULL) {
+			nodes[top] = node->left;
+			links[top] = &new_node->left;
+			top++;
+		}
+	}
+	free(links);
+	free(nodes);
+	return copy;
+}
+
+/**
+ * Copies the contents of the nodes below a node to an array in inorder.
+ * Uses a stack of the nodes whose left subtrees are being walked.
+ *
+ * @param items - array of items
+ * @param node - pointer to a node
+ * @param count - number of nodes below node
+ */
+static void splay_inorder_aux(data_ptr *items, const splay_node *node,
+		int count) {
+	const splay_node **stack = malloc(count * sizeof *stack);
+	int top = 0;
+	int index = 0;
+
+	while (node != NULL || top > 0) {
+
+		if (node != NULL) {
+			stack[top] = node;
+			top++;
+			node = node->left;
+		} else {
+			top--;
+			node = stack[top];
+			items[index] = node->item;
+			index++;
+			node = node->right;
+		}
+	}
+	free(stack);
+	return;
+}
+
+/**
+ * Copies the contents of the nodes below a node to an array in preorder.
+ * Uses a stack of the subtrees still to walk.
+ *
+ * @param items - array of items
+ * @param node - pointer to a node
+ * @param count - number of nodes below node
+ */
+static void splay_preorder_aux(data_ptr *items, const splay_node *node,
+		int count) {
+	const splay_node **stack = malloc(count * sizeof *stack);
+	int top = 0;
+	int index = 0;
+
+	if (node != NULL) {
+		stack[top] = node;
+		top++;
+	}
+	while (top > 0) {
+		top--;
+		node = stack[top];
+		items[index] = node->item;
+		index++;
+
+		if (node->right != NULL) {
+			stack[top] = node->right;
+			top++;
+		}
+		if (node->left != NULL) {
+			stack[top] = node->left;
+			top++;
+		}
+	}
+	free(stack);
+	return;
+}
+
+/**
+ * Copies the contents of the nodes below a node to an array in postorder.
+ * Postorder is the reverse of a preorder that visits right before left,
+ * so that walk fills the array from its end.
+ *
+ * @param items - array of items
+ * @param node - pointer to a node
+ * @param count - number of nodes below node
+ */
+static void splay_postorder_aux(data_ptr *items, const splay_node *node,
+		int count) {
+	const splay_node **stack = malloc(count * sizeof *stack);
+	int top = 0;
+	int index = count;
+
+	if (node != NULL) {
+		stack[top] = node;
+		top++;
+	}
+	while (top > 0) {
+		top--;
+		node = stack[top];
+		index--;
+		items[index] = node->item;
+
+		if (node->left != NULL) {
+			stack[top] = node->left;
+			top++;
+		}
+		if (node->right != NULL) {
+			stack[top] = node->right;
+			top++;
+		}
+	}
+	free(stack);
+	return;
+}
+
+/**
+ * Counts the nodes with zero, one and two children below a node.
+ *
+ * @param node - pointer to a node
+ * @param count - number of nodes below node
+ * @param counts - counts indexed by number of children
+ */
+static void splay_node_counts_aux(const splay_node *node, int count,
+		int counts[3]) {
+	const splay_node **stack = malloc(count * sizeof *stack);
+	int top = 0;
+
+	if (node != NULL) {
+		stack[top] = node;
+		top++;
+	}
+	while (top > 0) {
+		top--;
+		node = stack[top];
+		counts[(node->left != NULL) + (node->right != NULL)]++;
+
+		if (node->right != NULL) {
+			stack[top] = node->right;
+			top++;
+		}
+		if (node->left != NULL) {
+			stack[top] = node->left;
+			top++;
+		}
+	}
+	free(stack);
+	return;
+}
+
+/**
+ * Computes the height of a node if its subtree is balanced. The nodes are
+ * walked in postorder on a stack, and the height of each finished subtree
+ * is pushed on a second stack until its parent is reached: the right
+ * subtree's height is then on top, and the left's below it.
+ *
+ * @param node - pointer to a node
+ * @param count - number of nodes below node
+ * @return - height of node, -1 if any node below it is not balanced
+ */
+static int splay_balanced_aux(const splay_node *node, int count) {
+	const splay_node **stack = malloc(count * sizeof *stack);
+	int *heights = malloc(count * sizeof *heights);
+	const splay_node *last = NULL;
+	int top = 0;
+	int done = 0;
+	int height = 0;
+
+	while ((node != NULL || top > 0) && height >= 0) {
+
+		if (node != NULL) {
+			stack[top] = node;
+			top++;
+			node = node->left;
+		} else if (stack[top - 1]->right != NULL
+				&& stack[top - 1]->right != last) {
+			node = stack[top - 1]->right;
+		} else {
+			top--;
+			last = stack[top];
+			int right_height = 0;
+			int left_height = 0;
+
+			if (last->right != NULL) {
+				done--;
+				right_height = heights[done];
+			}
+			if (last->left != NULL) {
+				done--;
+				left_height = heights[done];
+			}
+			if (abs(left_height - right_height) > 1) {
+				height = -1;
+			} else {
+				height = (left_height > right_height ?
+						left_height : right_height) + 1;
+				heights[done] = height;
+				done++;
+			}
+		}
+	}
+	free(heights);
+	free(stack);
+	return height;
+}
+
+/**
+ * Determines whether the items below a node are in strictly increasing
+ * inorder, which holds exactly when each item is between the bounds set
+ * by its ancestors.
+ *
+ * @param node - pointer to a node
+ * @param count - number of nodes below node
+ * @return - TRUE if the subtree is a valid BST, FALSE otherwise
+ */
+static BOOLEAN splay_valid_aux(const splay_node *node, int count) {
+	const splay_node **stack = malloc(count * sizeof *stack);
+	const splay_node *previous = NULL;
+	BOOLEAN valid = TRUE;
+	int top = 0;
+
+	while ((node != NULL || top > 0) && valid) {
+
+		if (node != NULL) {
+			stack[top] = node;
+			top++;
+			node = node->left;
+		} else {
+			top--;
+			node = stack[top];
+			valid = previous == NULL
+					|| data_compare(node->item, previous->item) > 0;
+			previous = node;
+			node = node->right;
+		}
+	}
+	free(stack);
+	return valid;
+}
+
+/**
+ * Determines if two subtrees are equal. Pairs of nodes in the same place
+ * are compared in preorder from a stack.
+ *
+ * @param target_node - pointer to a node
+ * @param source_node - pointer to a node
+ * @param count - number of nodes below each of target_node and source_node
+ * @return - TRUE if the subtrees hold the same items in the same shape
+ */
+static BOOLEAN splay_equals_aux(const splay_node *target_node,
+		const splay_node *source_node, int count) {
+	const splay_node **targets = malloc(count * sizeof *targets);
+	const splay_node **sources = malloc(count * sizeof *sources);
+	BOOLEAN equals = (target_node == NULL) == (source_node == NULL);
+	int top = 0;
+
+	if (target_node != NULL && equals) {
+		targets[top] = target_node;
+		sources[top] = source_node;
+		top++;
+	}
+	while (top > 0 && equals) {
+		top--;
+		target_node = targets[top];
+		source_node = sources[top];
+		equals = data_compare(target_node->item, source_node->item) == 0
+				&& (target_node->left == NULL) == (source_node->left == NULL)
+				&& (target_node->right == NULL)
+						== (source_node->right == NULL);
+
+		if (equals && target_node->right != NULL) {
+			targets[top] = target_node->right;
+			sources[top] = source_node->right;
+			top++;
+		}
+		if (equals && target_node->left != NULL) {
+			targets[top] = target_node->left;
+			sources[top] = source_node->left;
+			top++;
+		}
+	}
+	free(sources);
+	free(targets);
+	return equals;
+}
+
+/**
+ * Private helper function to print contents of a splay tree in preorder.
+ *
+ * @param node - pointer to splay_node
+ * @param count - number of nodes below node
+ */
+static void splay_print_aux(const splay_node *node, int count) {
+	char string[DATA_STRING_SIZE];
+	const splay_node **stack = malloc(count * sizeof *stack);
+	int top = 0;
+
+	if (node != NULL) {
+		stack[top] = node;
+		top++;
+	}
+	while (top > 0) {
+		top--;
+		node = stack[top];
+		printf("%s\n", data_string(string, DATA_STRING_SIZE, node->item));
+
+		if (node->right != NULL) {
+			stack[top] = node->right;
+			top++;
+		}
+		if (node->left != NULL) {
+			stack[top] = node->left;
+			top++;
+		}
+	}
+	free(stack);
+	return;
+}
+
+//--------------------------------------------------------------------
+// Functions
+
+splay_linked* splay_initialize() {
+	splay_linked *source = malloc(sizeof *source);
+	source->root = NULL;
+	source->count = 0;
+	return source;
+}
+
+void splay_free(splay_linked **source) {
+	splay_free_aux((*source)->root);
+	free(*source);
+	*source = NULL;
+	return;
+}
+
+BOOLEAN splay_empty(const splay_linked *source) {
+	return (source->root == NULL);
+}
+
+BOOLEAN splay_full(const splay_linked *source) {
+	return FALSE;
+}
+
+int splay_count(const splay_linked *source) {
+	return (source->count);
+}
+
+BOOLEAN splay_insert(splay_linked *source, const data_ptr item) {
+	BOOLEAN inserted = FALSE;
+	splay_node *root = splay_aux(source->root, item);
+	int comp = 1;
+
+	if (root != NULL) {
+		comp = data_compare(item, root->item);
+	}
+	if (comp == 0) {
+		source->root = root;
+	} else {
+		// The old root is the neighbour of item: split around it.
+		splay_node *node = splay_node_initialize(item);
+
+		if (root != NULL && comp < 0) {
+			node->left = root->left;
+			node->right = root;
+			root->left = NULL;
+		} else if (root != NULL) {
+			node->right = root->right;
+			node->left = root;
+			root->right = NULL;
+		}
+		source->root = node;
+		source->count++;
+		inserted = TRUE;
+	}
+	return inserted;
+}
+
+BOOLEAN splay_retrieve(splay_linked *source, const data_ptr key,
+		data_ptr item) {
+	BOOLEAN retrieved = FALSE;
+
+	source->root = splay_aux(source->root, key);
+
+	if (source->root != NULL && data_compare(key, source->root->item) == 0) {
+		data_copy(item, source->root->item);
+		retrieved = TRUE;
+	}
+	return retrieved;
+}
+
+BOOLEAN splay_remove(splay_linked *source, const data_ptr key,
+		data_ptr item) {
+	BOOLEAN removed = FALSE;
+
+	source->root = splay_aux(source->root, key);
+
+	if (source->root != NULL && data_compare(key, source->root->item) == 0) {
+		splay_node *node = source->root;
+		data_copy(item, node->item);
+
+		if (node->left == NULL) {
+			source->root = node->right;
+		} else {
+			// Splaying the left subtree for key brings up its maximum,
+			// which then has no right child.
+			source->root = splay_aux(node->left, key);
+			source->root->right = node->right;
+		}
+		data_free(&node->item);
+		free(node);
+		source->count--;
+		removed = TRUE;
+	}
+	return removed;
+}
+
+void splay_copy(splay_linked **target, const splay_linked *source) {
+	*target = splay_initialize();
+	(*target)->root = splay_copy_aux(source->root, source->count);
+	(*target)->count = source->count;
+	return;
+}
+
+// Copies the contents of a splay tree to an array in inorder.
+void splay_inorder(const splay_linked *source, data_ptr *items) {
+	splay_inorder_aux(items, source->root, source->count);
+	return;
+}
+
+// Copies the contents of a splay tree to an array in preorder.
+void splay_preorder(const splay_linked *source, data_ptr *items) {
+	splay_preorder_aux(items, source->root, source->count);
+	return;
+}
+
+// Copies the contents of a splay tree to an array in postorder.
+void splay_postorder(const splay_linked *source, data_ptr *items) {
+	splay_postorder_aux(items, source->root, source->count);
+	return;
+}
+
+BOOLEAN splay_max(const splay_linked *source, data_ptr item) {
+	const splay_node *node = source->root;
+
+	if (node != NULL) {
+		while (node->right != NULL) {
+			node = node->right;
+		}
+		data_copy(item, node->item);
+	}
+	return (node != NULL);
+}
+
+BOOLEAN splay_min(const splay_linked *source, data_ptr item) {
+	const splay_node *node = source->root;
+
+	if (node != NULL) {
+		while (node->left != NULL) {
+			node = node->left;
+		}
+		data_copy(item, node->item);
+	}
+	return (node != NULL);
+}
+
+int splay_leaf_count(const splay_linked *source) {
+	int counts[3] = {0, 0, 0};
+	splay_node_counts_aux(source->root, source->count, counts);
+	return counts[0];
+}
+
+int splay_one_child_count(const splay_linked *source) {
+	int counts[3] = {0, 0, 0};
+	splay_node_counts_aux(source->root, source->count, counts);
+	return counts[1];
+}
+
+int splay_two_child_count(const splay_linked *source) {
+	int counts[3] = {0, 0, 0};
+	splay_node_counts_aux(source->root, source->count, counts);
+	return counts[2];
+}
+
+void splay_node_counts(const splay_linked *source, int *zero, int *one,
+		int *two) {
+	int counts[3] = {0, 0, 0};
+	splay_node_counts_aux(source->root, source->count, counts);
+	*zero = counts[0];
+	*one = counts[1];
+	*two = counts[2];
+	return;
+}
+
+BOOLEAN splay_balanced(const splay_linked *source) {
+	return (splay_balanced_aux(source->root, source->count) >= 0);
+}
+
+BOOLEAN splay_valid(const splay_linked *source) {
+	return (splay_valid_aux(source->root, source->count));
+}
+
+BOOLEAN splay_equals(const splay_linked *target, const splay_linked *source) {
+	return (target->count == source->count
+			&& splay_equals_aux(target->root, source->root, source->count));
+}
+
+// Prints the items in a splay tree in preorder.
+void splay_print(const splay_linked *source) {
+	printf("  count: %d, items:\n", source->count);
+	splay_print_aux(source->root, source->count);
+	printf("\n");
+	return;
+}
@@ -0,0 +1,235 @@
+/**
+ * -------------------------------------
+ * @file  splay_linked.h
+ * Linked Splay Tree Header File
+ * -------------------------------------
+ * @author Filip Stanojcic
+ *
+ * @version 2026-10-18
+ *
+ * A self-adjusting BST with the same interface as bst_linked. Every
+ * insert, retrieve and remove splays the key it looks for to the root
+ * top-down, so recently used keys stay near the top and a run of
+ * accesses costs O(log n) amortized each, less when accesses are skewed.
+ */
+#ifndef SPLAY_LINKED_H_
+#define SPLAY_LINKED_H_
+
+// Includes
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "data.h"
+
+// typedefs
+/**
+ * Splay tree node
+ */
+typedef struct SPLAY_NODE {
+    data_ptr item;           // Pointer to the node data.
+    struct SPLAY_NODE *left; // Pointer to the left child.
+    struct SPLAY_NODE *right; // Pointer to the right child.
+} splay_node;
+
+/**
+ * Splay tree header
+ */
+typedef struct {
+    int count;               // Number of nodes in the splay tree.
+    splay_node *root;        // Pointer to root node of the splay tree.
+} splay_linked;
+
+// Prototypes
+
+/**
+ * Initializes a splay tree.
+ *
+ * @return pointer to a splay tree
+ */
+splay_linked* splay_initialize();
+
+/**
+ * Frees all parts of a splay tree.
+ *
+ * @param source - pointer to a splay tree
+ */
+void splay_free(splay_linked **source);
+
+/**
+ * Determines if a splay tree is empty.
+ *
+ * @param source - pointer to a splay tree
+ * @return TRUE if the splay tree is empty, FALSE otherwise
+ */
+BOOLEAN splay_empty(const splay_linked *source);
+
+/**
+ * Determines if a splay tree is full.
+ *
+ * @param source - pointer to a splay tree
+ * @return - TRUE if the splay tree is full, FALSE otherwise
+ */
+BOOLEAN splay_full(const splay_linked *source);
+
+/**
+ * Returns number of items in a splay tree.
+ *
+ * @param source - pointer to a splay tree
+ * @return - number of items in splay tree
+ */
+int splay_count(const splay_linked *source);
+
+/**
+ * Inserts a copy of an item into a splay tree. The item, or the item
+ * already matching it, ends up at the root.
+ *
+ * @param source - pointer to a splay tree
+ * @param item - pointer to the item to insert
+ * @return - TRUE if item inserted, FALSE otherwise
+ */
+BOOLEAN splay_insert(splay_linked *source, const data_ptr item);
+
+/**
+ * Retrieves a copy of a value matching key in a splay tree, and moves it
+ * to the root. If key is not found, the last node visited moves instead.
+ *
+ * @param source - pointer to a splay tree
+ * @param key - key value to search for
+ * @param item - pointer to copy of the item retrieved
+ * @return - TRUE if item retrieved, FALSE otherwise (key not found)
+ */
+BOOLEAN splay_retrieve(splay_linked *source, const data_ptr key,
+        data_ptr item);
+
+/**
+ * Removes a value matching key in a splay tree.
+ *
+ * @param source - pointer to a splay tree
+ * @param key - key value to search for
+ * @param item - pointer to the item removed
+ * @return - TRUE if item removed, FALSE otherwise (key not found)
+ */
+BOOLEAN splay_remove(splay_linked *source, const data_ptr key,
+        data_ptr item);
+
+/**
+ * Copies source to target.
+ *
+ * @param target - pointer to a splay tree
+ * @param source - pointer to a splay tree
+ */
+void splay_copy(splay_linked **target, const splay_linked *source);
+
+/**
+ * Copies the contents of a splay tree to an array in inorder.
+ *
+ * @param source - pointer to a splay tree
+ * @param items - array of items: length must be at least size of splay tree
+ */
+void splay_inorder(const splay_linked *source, data_ptr *items);
+
+/**
+ * Copies the contents of a splay tree to an array in preorder.
+ *
+ * @param source - pointer to a splay tree
+ * @param items - array of items: length must be at least size of splay tree
+ */
+void splay_preorder(const splay_linked *source, data_ptr *items);
+
+/**
+ * Copies the contents of a tree to an array in postorder.
+ *
+ * @param source - pointer to a splay tree
+ * @param items - array of items: length must be at least size of splay tree
+ */
+void splay_postorder(const splay_linked *source, data_ptr *items);
+
+/**
+ * Finds the maximum item in a splay tree.
+ *
+ * @param source - pointer to a splay tree
+ * @param item - pointer to copy of maximum item
+ * @return - TRUE if a maximum value is found, FALSE otherwise (tree is empty)
+ */
+BOOLEAN splay_max(const splay_linked *source, data_ptr item);
+
+/**
+ * Finds the minimum item in a splay tree.
+ *
+ * @param source - pointer to a splay tree
+ * @param item - pointer to copy of minimum item
+ * @return - TRUE if a minimum value is found, FALSE otherwise (tree is empty)
+ */
+BOOLEAN splay_min(const splay_linked *source, data_ptr item);
+
+/**
+ * Finds the number of leaf nodes in a tree.
+ *
+ * @param source - pointer to a splay tree
+ * @return - count of nodes with no children.
+ */
+int splay_leaf_count(const splay_linked *source);
+
+/**
+ * Finds the number of nodes with one child in a tree.
+ *
+ * @param source - pointer to a splay tree
+ * @return - count of nodes with one child.
+ */
+int splay_one_child_count(const splay_linked *source);
+
+/**
+ * Finds the number of nodes with two children in a tree.
+ *
+ * @param source - pointer to a splay tree
+ * @return - count of nodes with two children
+ */
+int splay_two_child_count(const splay_linked *source);
+
+/**
+ * Determines the number of nodes with zero, one, and two children.
+ *
+ * @param source - pointer to a splay tree
+ * @param zero - count of leaf nodes (no children)
+ * @param one - count of nodes with one child
+ * @param two - count of nodes with two children
+ */
+void splay_node_counts(const splay_linked *source, int *zero, int *one,
+        int *two);
+
+/**
+ * Determines whether or not a tree is a balanced tree. Splay trees keep
+ * no heights, so they are computed.
+ * All node heights are no more than one greater than any child heights.
+ *
+ * @param source - pointer to a splay tree
+ * @return - TRUE if source is balanced, FALSE otherwise
+ */
+BOOLEAN splay_balanced(const splay_linked *source);
+
+/**
+ * Determines whether or not a tree is a valid BST.
+ *
+ * @param source - pointer to a splay tree
+ * @return - TRUE if source is valid, FALSE otherwise
+ */
+BOOLEAN splay_valid(const splay_linked *source);
+
+/**
+ * Determines if two trees contain same data in same configuration.
+ *
+ * @param target - pointer to a splay tree
+ * @param source - pointer to a splay tree
+ * @return - TRUE if target is identical to source, FALSE otherwise
+ */
+BOOLEAN splay_equals(const splay_linked *target, const splay_linked *source);
+
+/**
+ * Prints the items in a splay tree in preorder.
+ *
+ * @param source - pointer to a splay tree
+ */
+void splay_print(const splay_linked *source);
+
+#endif /* SPLAY_LINKED_H_ */
@@ -0,0 +1,132 @@
+/**
+ * -------------------------------------
+ * @file  main.c
+ * Main Source Code File
+ * -------------------------------------
+ * @author Filip Stanojcic
+ *
+ * @version 2026-10-18
+ *
+ */
+// Includes
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "data.h"
+#include "treap_linked.h"
+
+#define BENCH_KEYS 1000000 // Keys in the benchmark treap
+#define BENCH_PARTS 4      // Key ranges the benchmark treap is split into
+
+/**
+ * Prints the items of a treap in order.
+ *
+ * @param label - text printed before the items
+ * @param source - pointer to a treap
+ */
+static void print_inorder(const char *label, const treap_linked *source) {
+    data_ptr values[treap_count(source) + 1];
+    treap_inorder(source, values);
+    printf("%s {", label);
+
+    for(int i = 0; i < treap_count(source); i++) {
+        printf("%d, ", *values[i]);
+    }
+    printf("}\n");
+}
+
+/**
+ * Simple treap testing.
+ */
+void test_treap(void) {
+    int numbers[] = {11, 7, 6, 9, 8, 15, 12, 18};
+    int count = sizeof numbers / sizeof *numbers;
+    treap_linked *source = treap_initialize();
+
+    for(int i = 0; i < count; i++) {
+        treap_insert(source, &numbers[i]);
+    }
+    treap_print(source);
+    int item = 0;
+    treap_remove(source, &numbers[0], &item);
+    printf("  removed: %d\n", item);
+    print_inorder("inorder:   ", source);
+    int key = 9;
+    treap_linked *upper = treap_split(source, &key);
+    print_inorder("split low: ", source);
+    print_inorder("split high:", upper);
+    treap_merge(source, &upper);
+    int low = 7;
+    int high = 12;
+    treap_linked *range = treap_extract_range(source, &low, &high);
+    print_inorder("range:     ", range);
+    print_inorder("rest:      ", source);
+    printf("valid: %s\n", BOOL_TO_STR(treap_valid(source)));
+    treap_free(&range);
+    treap_free(&source);
+}
+
+/**
+ * Times building a treap from sorted keys against inserting them one at a
+ * time, then splits it into key ranges and merges them back.
+ */
+void bench_treap(void) {
+    int *keys = malloc(BENCH_KEYS * sizeof *keys);
+    data_ptr *items = malloc(BENCH_KEYS * sizeof *items);
+
+    for(int i = 0; i < BENCH_KEYS; i++) {
+        keys[i] = i;
+        items[i] = &keys[i];
+    }
+    clock_t start = clock();
+    treap_linked *source = treap_initialize();
+
+    for(int i = 0; i < BENCH_KEYS; i++) {
+        treap_insert(source, items[i]);
+    }
+    double insert_time = (double) (clock() - start) / CLOCKS_PER_SEC;
+    treap_free(&source);
+    start = clock();
+    source = treap_build(items, BENCH_KEYS);
+    double build_time = (double) (clock() - start) / CLOCKS_PER_SEC;
+    printf("%d sorted keys: insert %.3fs, build %.3fs\n", BENCH_KEYS,
+            insert_time, build_time);
+
+    treap_linked *parts[BENCH_PARTS];
+    start = clock();
+
+    // Cut from the top so each part keeps one key range.
+    for(int i = BENCH_PARTS - 1; i > 0; i--) {
+        int key = BENCH_KEYS / BENCH_PARTS * i;
+        parts[i] = treap_split(source, &key);
+    }
+    parts[0] = source;
+
+    for(int i = 1; i < BENCH_PARTS; i++) {
+        treap_merge(parts[0], &parts[i]);
+    }
+    double split_time = (double) (clock() - start) / CLOCKS_PER_SEC;
+    printf("split into %d parts and merged: %.6fs, count: %d, valid: %s\n",
+            BENCH_PARTS, split_time, treap_count(parts[0]),
+            BOOL_TO_STR(treap_valid(parts[0])));
+    treap_free(&parts[0]);
+    free(items);
+    free(keys);
+}
+
+/**
+ * Test the treap functions.
+ *
+ * @param argc - unused
+ * @param argv - unused
+ * @return EXIT_SUCCESS
+ */
+int main(int argc, char *argv[]) {
+    setbuf(stdout, NULL);
+
+    test_treap();
+    bench_treap();
+
+    return (EXIT_SUCCESS);
+}
@@ -0,0 +1,481 @@
+/**
+ * -------------------------------------
+ * @file  treap_linked.c
+ * Linked Treap Source Code File
+ * -------------------------------------
+ * @author Filip Stanojcic
+ *
+ * @version 2026-10-18
+ *
+ */
+// Includes
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "treap_linked.h"
+
+//--------------------------------------------------------------------
+// Local Static Helper Functions
+
+/**
+ * Returns the next random priority of a treap (xorshift).
+ *
+ * @param source - pointer to a treap
+ * @return - a random priority
+ */
+static unsigned int treap_random(treap_linked *source) {
+	source->seed ^= source->seed << 13;
+	source->seed ^= source->seed >> 17;
+	source->seed ^= source->seed << 5;
+	return source->seed;
+}
+
+/**
+ * Initializes a new treap node with a copy of item.
+ *
+ * @param item - pointer to the item to assign to the node
+ * @param priority - the priority of the node
+ * @return a pointer to a new treap node
+ */
+static treap_node* treap_node_initialize(const data_ptr item,
+		unsigned int priority) {
+	treap_node *node = malloc(sizeof *node);
+	node->item = malloc(sizeof *node->item);
+	data_copy(node->item, item);
+	node->priority = priority;
+	node->size = 1;
+	node->left = NULL;
+	node->right = NULL;
+	return node;
+}
+
+/**
+ * Helper function to determine the size of node - handles empty node.
+ * @param node - The node to process.
+ * @return The number of nodes in the subtree.
+ */
+static int treap_node_size(const treap_node *node) {
+	int size = 0;
+
+	if (node != NULL) {
+		size = node->size;
+	}
+	return size;
+}
+
+/**
+ * Updates the size of a node from its children.
+ * @param node - The node to process.
+ */
+static void treap_update_size(treap_node *node) {
+	node->size = treap_node_size(node->left) + 1
+			+ treap_node_size(node->right);
+	return;
+}
+
+/**
+ * Initializes an empty treap whose priorities continue from another.
+ *
+ * @param source - pointer to a treap
+ * @return pointer to a new treap
+ */
+static treap_linked* treap_initialize_from(treap_linked *source) {
+	treap_linked *target = treap_initialize();
+	target->seed = treap_random(source) | 1;
+	return target;
+}
+
+/**
+ * Splits the subtree at node into the items before key and the rest.
+ *
+ * @param node - The node to process.
+ * @param key - key value to split at
+ * @param inclusive - TRUE to put an item equal to key on the left
+ * @param left - set to the subtree of items before key
+ * @param right - set to the subtree of the other items
+ */
+static void treap_split_aux(treap_node *node, const data_ptr key,
+		BOOLEAN inclusive, treap_node **left, treap_node **right) {
+
+	if (node == NULL) {
+		*left = NULL;
+		*right = NULL;
+	} else {
+		int comp = data_compare(node->item, key);
+
+		if (comp < 0 || (comp == 0 && inclusive)) {
+			// node and its left subtree go left.
+			treap_split_aux(node->right, key, inclusive, &node->right, right);
+			*left = node;
+		} else {
+			treap_split_aux(node->left, key, inclusive, left, &node->left);
+			*right = node;
+		}
+		treap_update_size(node);
+	}
+	return;
+}
+
+/**
+ * Merges two subtrees where every item in left is before every item in
+ * right. The root with the higher priority stays on top.
+ *
+ * @param left - subtree of smaller items
+ * @param right - subtree of greater items
+ * @return the root of the merged subtree
+ */
+static treap_node* treap_merge_aux(treap_node *left, treap_node *right) {
+	treap_node *node = NULL;
+
+	if (left == NULL) {
+		node = right;
+	} else if (right == NULL) {
+		node = left;
+	} else if (left->priority > right->priority) {
+		left->right = treap_merge_aux(left->right, right);
+		node = left;
+	} else {
+		right->left = treap_merge_aux(left, right->left);
+		node = right;
+	}
+	if (node != NULL) {
+		treap_update_size(node);
+	}
+	return node;
+}
+
+/**
+ * Finds the node matching key.
+ *
+ * @param node - The root of the subtree to search.
+ * @param key - The key to look for.
+ * @return the node matching key, NULL if key is not found
+ */
+static const treap_node* treap_search(const treap_node *node,
+		const data_ptr key) {
+	int comp = 1;
+
+	while (node != NULL && (comp = data_compare(key, node->item)) != 0) {
+		node = (comp < 0) ? node->left : node->right;
+	}
+	return node;
+}
+
+/**
+ * Inserts a new node below node. The new node replaces the first node
+ * with a lower priority, which is split around it.
+ *
+ * @param node - The node to process.
+ * @param new_node - The node to insert, not matching any item.
+ * @return the root of the subtree
+ */
+static treap_node* treap_insert_aux(treap_node *node, treap_node *new_node) {
+
+	if (node == NULL) {
+		node = new_node;
+	} else if (new_node->priority > node->priority) {
+		treap_split_aux(node, new_node->item, FALSE, &new_node->left,
+				&new_node->right);
+		treap_update_size(new_node);
+		node = new_node;
+	} else {
+		if (data_compare(new_node->item, node->item) < 0) {
+			node->left = treap_insert_aux(node->left, new_node);
+		} else {
+			node->right = treap_insert_aux(node->right, new_node);
+		}
+		node->size++;
+	}
+	return node;
+}
+
+/**
+ * Attempts to find an item matching key below node. Replaces the node with
+ * the merge of its children if found.
+ *
+ * @param node - The node to process.
+ * @param key - The key to look for.
+ * @param item - If key is found, the item being removed.
+ * @return TRUE if the key is found and the item removed, FALSE otherwise.
+ */
+static BOOLEAN treap_remove_aux(treap_node **node, const data_ptr key,
+		data_ptr item) {
+	BOOLEAN removed = FALSE;
+
+	if (*node != NULL) {
+		int comp = data_compare(key, (*node)->item);
+
+		if (comp < 0) {
+			removed = treap_remove_aux(&(*node)->left, key, item);
+		} else if (comp > 0) {
+			removed = treap_remove_aux(&(*node)->right, key, item);
+		} else {
+			treap_node *temp = *node;
+			data_copy(item, temp->item);
+			*node = treap_merge_aux(temp->left, temp->right);
+			data_free(&temp->item);
+			free(temp);
+			removed = TRUE;
+		}
+		if (removed && comp != 0) {
+			(*node)->size--;
+		}
+	}
+	return removed;
+}
+
+/**
+ * Recomputes the sizes of a subtree from its leaves up.
+ * @param node - The node to process.
+ * @return The size of the subtree.
+ */
+static int treap_sizes_aux(treap_node *node) {
+	int size = 0;
+
+	if (node != NULL) {
+		node->size = treap_sizes_aux(node->left) + 1
+				+ treap_sizes_aux(node->right);
+		size = node->size;
+	}
+	return size;
+}
+
+/**
+ * Frees a node and its children.
+ * @param node - The node to process
+ */
+static void treap_free_aux(treap_node *node) {
+
+	if (node != NULL) {
+		treap_free_aux(node->left);
+		treap_free_aux(node->right);
+		data_free(&node->item);
+		free(node);
+	}
+	return;
+}
+
+/**
+ * Copies the contents of a node to an array location in inorder.
+ *
+ * @param items - array of items
+ * @param node - pointer to a node
+ * @param index - current index in array
+ * @return - the updated index
+ */
+static int treap_inorder_aux(data_ptr *items, const treap_node *node,
+		int index) {
+
+	if (node != NULL) {
+		index = treap_inorder_aux(items, node->left, index);
+		items[index] = node->item;
+		index++;
+		index = treap_inorder_aux(items, node->right, index);
+	}
+	return index;
+}
+
+/**
+ * Determines whether a subtree is a valid treap with items between two
+ * bounds and priorities no higher than a parent's.
+ *
+ * @param node - pointer to a node
+ * @param low - items must be greater than low, NULL for no bound
+ * @param high - items must be less than high, NULL for no bound
+ * @param priority - priority of the parent node
+ * @return - TRUE if the subtree is valid, FALSE otherwise
+ */
+static BOOLEAN treap_valid_aux(const treap_node *node, const data_ptr low,
+		const data_ptr high, unsigned int priority) {
+	BOOLEAN valid = TRUE;
+
+	if (node != NULL) {
+		valid = (low == NULL || data_compare(node->item, low) > 0)
+				&& (high == NULL || data_compare(node->item, high) < 0)
+				&& node->priority <= priority
+				&& node->size == treap_node_size(node->left) + 1
+								+ treap_node_size(node->right)
+				&& treap_valid_aux(node->left, low, node->item,
+						node->priority)
+				&& treap_valid_aux(node->right, node->item, high,
+						node->priority);
+	}
+	return valid;
+}
+
+/**
+ * Private helper function to print contents of a treap in preorder.
+ *
+ * @param node - pointer to treap_node
+ */
+static void treap_print_aux(const treap_node *node) {
+	char string[DATA_STRING_SIZE];
+
+	if (node != NULL) {
+		printf("%s\n", data_string(string, DATA_STRING_SIZE, node->item));
+		treap_print_aux(node->left);
+		treap_print_aux(node->right);
+	}
+	return;
+}
+
+//--------------------------------------------------------------------
+// Functions
+
+treap_linked* treap_initialize() {
+	treap_linked *source = malloc(sizeof *source);
+	source->root = NULL;
+	source->count = 0;
+	source->seed = TREAP_SEED;
+	return source;
+}
+
+treap_linked* treap_build(data_ptr *items, int count) {
+	treap_linked *source = treap_initialize();
+	treap_node **spine = malloc(count * sizeof *spine);
+	int top = 0;
+
+	// The right spine of the treap built so far, root first. Each new node
+	// is the greatest, so it goes on the spine below the last node with a
+	// higher priority and takes the nodes it passes as its left subtree.
+	for (int i = 0; i < count; i++) {
+		treap_node *node = treap_node_initialize(items[i],
+				treap_random(source));
+		treap_node *last = NULL;
+
+		while (top > 0 && spine[top - 1]->priority < node->priority) {
+			top--;
+			last = spine[top];
+		}
+		node->left = last;
+
+		if (top > 0) {
+			spine[top - 1]->right = node;
+		}
+		spine[top] = node;
+		top++;
+	}
+	if (count > 0) {
+		source->root = spine[0];
+	}
+	free(spine);
+	treap_sizes_aux(source->root);
+	source->count = count;
+	return source;
+}
+
+void treap_free(treap_linked **source) {
+	treap_free_aux((*source)->root);
+	free(*source);
+	*source = NULL;
+	return;
+}
+
+BOOLEAN treap_empty(const treap_linked *source) {
+	return (source->root == NULL);
+}
+
+BOOLEAN treap_full(const treap_linked *source) {
+	return FALSE;
+}
+
+int treap_count(const treap_linked *source) {
+	return (source->count);
+}
+
+BOOLEAN treap_insert(treap_linked *source, const data_ptr item) {
+	BOOLEAN inserted = (treap_search(source->root, item) == NULL);
+
+	if (inserted) {
+		treap_node *node = treap_node_initialize(item, treap_random(source));
+		source->root = treap_insert_aux(source->root, node);
+		source->count++;
+	}
+	return inserted;
+}
+
+BOOLEAN treap_retrieve(const treap_linked *source, const data_ptr key,
+		data_ptr item) {
+	const treap_node *node = treap_search(source->root, key);
+
+	if (node != NULL) {
+		data_copy(item, node->item);
+	}
+	return (node != NULL);
+}
+
+BOOLEAN treap_remove(treap_linked *source, const data_ptr key,
+		data_ptr item) {
+	BOOLEAN removed = treap_remove_aux(&source->root, key, item);
+
+	if (removed) {
+		source->count--;
+	}
+	return removed;
+}
+
+treap_linked* treap_split(treap_linked *source, const data_ptr key) {
+	treap_linked *target = treap_initialize_from(source);
+
+	treap_split_aux(source->root, key, FALSE, &source->root, &target->root);
+	source->count = treap_node_size(source->root);
+	target->count = treap_node_size(target->root);
+	return target;
+}
+
+BOOLEAN treap_merge(treap_linked *target, treap_linked **source) {
+	BOOLEAN merged = TRUE;
+
+	if (target->root != NULL && (*source)->root != NULL) {
+		const treap_node *max = target->root;
+		const treap_node *min = (*source)->root;
+
+		while (max->right != NULL) {
+			max = max->right;
+		}
+		while (min->left != NULL) {
+			min = min->left;
+		}
+		merged = (data_compare(max->item, min->item) < 0);
+	}
+	if (merged) {
+		target->root = treap_merge_aux(target->root, (*source)->root);
+		target->count += (*source)->count;
+		free(*source);
+		*source = NULL;
+	}
+	return merged;
+}
+
+treap_linked* treap_extract_range(treap_linked *source, const data_ptr low,
+		const data_ptr high) {
+	treap_linked *target = treap_initialize_from(source);
+	treap_node *middle = NULL;
+	treap_node *right = NULL;
+
+	treap_split_aux(source->root, low, FALSE, &source->root, &middle);
+	treap_split_aux(middle, high, TRUE, &target->root, &right);
+	source->root = treap_merge_aux(source->root, right);
+	source->count = treap_node_size(source->root);
+	target->count = treap_node_size(target->root);
+	return target;
+}
+
+// Copies the contents of a treap to an array in inorder.
+void treap_inorder(const treap_linked *source, data_ptr *items) {
+	treap_inorder_aux(items, source->root, 0);
+	return;
+}
+
+BOOLEAN treap_valid(const treap_linked *source) {
+	return (source->count == treap_node_size(source->root)
+			&& treap_valid_aux(source->root, NULL, NULL, ~0u));
+}
+
+// Prints the items in a treap in preorder.
+void treap_print(const treap_linked *source) {
+	printf("  count: %d, items:\n", source->count);
+	treap_print_aux(source->root);
+	printf("\n");
+	return;
+}
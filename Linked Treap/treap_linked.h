@@ -0,0 +1,185 @@
+/**
+ * -------------------------------------
+ * @file  treap_linked.h
+ * Linked Treap Header File
+ * -------------------------------------
+ * @author Filip Stanojcic
+ *
+ * @version 2026-10-18
+ *
+ * A BST whose nodes also get random priorities and are kept in heap order
+ * by priority, which keeps the expected depth O(log n) without heights or
+ * rotations. Every update is built on split (cut a treap in two at a key)
+ * and merge (join two treaps whose key ranges do not overlap), both
+ * O(log n) expected, so key ranges can be handed out and joined back
+ * cheaply, e.g. to partition work across threads.
+ */
+#ifndef TREAP_LINKED_H_
+#define TREAP_LINKED_H_
+
+// Includes
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "data.h"
+
+#define TREAP_SEED 2463534242u // Initial state of the priority generator
+
+// typedefs
+/**
+ * Treap node
+ */
+typedef struct TREAP_NODE {
+    data_ptr item;           // Pointer to the node data.
+    unsigned int priority;   // Random priority: no child has a higher one.
+    int size;                // Number of nodes in the subtree.
+    struct TREAP_NODE *left; // Pointer to the left child.
+    struct TREAP_NODE *right; // Pointer to the right child.
+} treap_node;
+
+/**
+ * Treap header
+ */
+typedef struct {
+    int count;               // Number of nodes in the treap.
+    unsigned int seed;       // State of the priority generator.
+    treap_node *root;        // Pointer to root node of the treap.
+} treap_linked;
+
+// Prototypes
+
+/**
+ * Initializes a treap.
+ *
+ * @return pointer to a treap
+ */
+treap_linked* treap_initialize();
+
+/**
+ * Builds a treap from items in strictly increasing order in O(n).
+ *
+ * @param items - array of items in increasing order
+ * @param count - number of items
+ * @return pointer to a treap holding copies of items
+ */
+treap_linked* treap_build(data_ptr *items, int count);
+
+/**
+ * Frees all parts of a treap.
+ *
+ * @param source - pointer to a treap
+ */
+void treap_free(treap_linked **source);
+
+/**
+ * Determines if a treap is empty.
+ *
+ * @param source - pointer to a treap
+ * @return TRUE if the treap is empty, FALSE otherwise
+ */
+BOOLEAN treap_empty(const treap_linked *source);
+
+/**
+ * Determines if a treap is full.
+ *
+ * @param source - pointer to a treap
+ * @return - TRUE if the treap is full, FALSE otherwise
+ */
+BOOLEAN treap_full(const treap_linked *source);
+
+/**
+ * Returns number of items in a treap.
+ *
+ * @param source - pointer to a treap
+ * @return - number of items in treap
+ */
+int treap_count(const treap_linked *source);
+
+/**
+ * Inserts a copy of an item into a treap.
+ *
+ * @param source - pointer to a treap
+ * @param item - pointer to the item to insert
+ * @return - TRUE if item inserted, FALSE otherwise
+ */
+BOOLEAN treap_insert(treap_linked *source, const data_ptr item);
+
+/**
+ * Retrieves a copy of a value matching key in a treap.
+ *
+ * @param source - pointer to a treap
+ * @param key - key value to search for
+ * @param item - pointer to copy of the item retrieved
+ * @return - TRUE if item retrieved, FALSE otherwise (key not found)
+ */
+BOOLEAN treap_retrieve(const treap_linked *source, const data_ptr key,
+        data_ptr item);
+
+/**
+ * Removes a value matching key in a treap.
+ *
+ * @param source - pointer to a treap
+ * @param key - key value to search for
+ * @param item - pointer to the item removed
+ * @return - TRUE if item removed, FALSE otherwise (key not found)
+ */
+BOOLEAN treap_remove(treap_linked *source, const data_ptr key,
+        data_ptr item);
+
+/**
+ * Moves every item not less than key from source into a new treap.
+ *
+ * @param source - pointer to a treap, left with the items less than key
+ * @param key - key value to split at
+ * @return - pointer to a treap with the items not less than key
+ */
+treap_linked* treap_split(treap_linked *source, const data_ptr key);
+
+/**
+ * Moves every item of source into target and frees source. Every item in
+ * source must be greater than every item in target.
+ *
+ * @param target - pointer to a treap
+ * @param source - pointer to a treap with greater items
+ * @return - TRUE if the treaps were merged, FALSE if their ranges overlap
+ */
+BOOLEAN treap_merge(treap_linked *target, treap_linked **source);
+
+/**
+ * Moves every item from low to high, inclusive, from source into a new
+ * treap.
+ *
+ * @param source - pointer to a treap
+ * @param low - lowest key to extract
+ * @param high - highest key to extract
+ * @return - pointer to a treap with the extracted items
+ */
+treap_linked* treap_extract_range(treap_linked *source, const data_ptr low,
+        const data_ptr high);
+
+/**
+ * Copies the contents of a treap to an array in inorder.
+ *
+ * @param source - pointer to a treap
+ * @param items - array of items: length must be at least size of treap
+ */
+void treap_inorder(const treap_linked *source, data_ptr *items);
+
+/**
+ * Determines whether or not a treap is valid: items in BST order,
+ * priorities in heap order and sizes correct.
+ *
+ * @param source - pointer to a treap
+ * @return - TRUE if source is valid, FALSE otherwise
+ */
+BOOLEAN treap_valid(const treap_linked *source);
+
+/**
+ * Prints the items in a treap in preorder.
+ *
+ * @param source - pointer to a treap
+ */
+void treap_print(const treap_linked *source);
+
+#endif /* TREAP_LINKED_H_ */
@@ -0,0 +1,80 @@
+/**
+ * -------------------------------------
+ * @file  bucket_queue.c
+ * Bucket Queue Source Code File
+ * -------------------------------------
+ * @author Filip Stanojcic
+ *
+ * @version 2026-10-18
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bucket_queue.h"
+
+// Public bucket queue functions
+
+bucket_queue* bucket_queue_initialize(int span) {
+	bucket_queue *source = malloc(sizeof *source);
+	source->count = 0;
+	source->span = span;
+	source->last = 0;
+	source->buckets = calloc(span + 1, sizeof *source->buckets);
+	return source;
+}
+
+void bucket_queue_free(bucket_queue **source) {
+
+	for (int b = 0; b <= (*source)->span; b++) {
+		free((*source)->buckets[b].ids);
+	}
+	free((*source)->buckets);
+	free(*source);
+	*source = NULL;
+	return;
+}
+
+int bucket_queue_empty(const bucket_queue *source) {
+	return (source->count == 0);
+}
+
+int bucket_queue_count(const bucket_queue *source) {
+	return (source->count);
+}
+
+int bucket_queue_insert(bucket_queue *source, int key, int id) {
+	int inserted = (key >= source->last && key - source->last <= source->span);
+
+	if (inserted) {
+		bucket_queue_bucket *bucket = &source->buckets[key % (source->span + 1)];
+
+		if (bucket->count == bucket->capacity) {
+			bucket->capacity = bucket->capacity == 0 ? 4 : bucket->capacity * 2;
+			bucket->ids = realloc(bucket->ids,
+					bucket->capacity * sizeof *bucket->ids);
+		}
+		bucket->ids[bucket->count] = id;
+		bucket->count++;
+		source->count++;
+	}
+	return inserted;
+}
+
+int bucket_queue_remove(bucket_queue *source, int *id) {
+	int b = source->last % (source->span + 1);
+
+	// Step forward to the next key value that has ids.
+	while (source->buckets[b].count == 0) {
+		source->last++;
+		b = b == source->span ? 0 : b + 1;
+	}
+	bucket_queue_bucket *bucket = &source->buckets[b];
+	bucket->count--;
+	source->count--;
+
+	if (id != NULL) {
+		*id = bucket->ids[bucket->count];
+	}
+	return source->last;
+}
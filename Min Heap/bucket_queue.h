@@ -0,0 +1,97 @@
+/**
+ * -------------------------------------
+ * @file  bucket_queue.h
+ * Bucket Queue Header File
+ * -------------------------------------
+ * @author Filip Stanojcic
+ *
+ * @version 2026-10-18
+ *
+ * Dial's bucket queue: a monotone priority queue of non-negative int keys,
+ * each with an int id, where no key inserted is more than span above the
+ * last key removed. With Dijkstra's algorithm span is the largest edge
+ * weight. The keys in the queue then fall in span + 1 consecutive values,
+ * so a circular array of span + 1 buckets holds one key value per bucket.
+ * Insert is O(1), and remove is O(1) amortized plus the empty buckets it
+ * steps over, at most span per remove.
+ */
+#ifndef BUCKET_QUEUE_H_
+#define BUCKET_QUEUE_H_
+
+// Includes
+#include <stdio.h>
+#include <stdlib.h>
+
+/**
+ * The ids with one key value.
+ */
+typedef struct {
+    int count;    // number of ids in the bucket
+    int capacity; // current capacity of ids
+    int *ids;     // the ids
+} bucket_queue_bucket;
+
+/**
+ * Bucket queue header.
+ */
+typedef struct {
+    int count;                    // number of ids in the queue
+    int span;                     // largest key above the last key removed
+    int last;                     // last key removed
+    bucket_queue_bucket *buckets; // bucket of key k is k % (span + 1)
+} bucket_queue;
+
+// Prototypes
+
+/**
+ * Initialize a bucket queue.
+ *
+ * @param span - largest amount a key may exceed the last key removed by
+ * @return - pointer to a bucket queue
+ */
+bucket_queue* bucket_queue_initialize(int span);
+
+/**
+ * Frees bucket queue memory.
+ *
+ * @param source - pointer to a bucket queue
+ */
+void bucket_queue_free(bucket_queue **source);
+
+/**
+ * Determines if source is empty.
+ *
+ * @param source - pointer to a bucket queue
+ * @return - 1 if source is empty, 0 otherwise.
+ */
+int bucket_queue_empty(const bucket_queue *source);
+
+/**
+ * Returns the number of ids in source.
+ *
+ * @param source - pointer to a bucket queue
+ * @return - number of ids in source
+ */
+int bucket_queue_count(const bucket_queue *source);
+
+/**
+ * Adds a key and its id to source.
+ *
+ * @param source - pointer to a bucket queue
+ * @param key - the key to add, from the last key removed to span above it
+ * @param id - the id of key
+ * @return - 1 if the key was added, 0 if it is out of range
+ */
+int bucket_queue_insert(bucket_queue *source, int key, int id);
+
+/**
+ * Removes and returns the smallest key in source. source must not be
+ * empty.
+ *
+ * @param source - pointer to a bucket queue
+ * @param id - set to the id of the key, if not NULL
+ * @return - the smallest key
+ */
+int bucket_queue_remove(bucket_queue *source, int *id);
+
+#endif /* BUCKET_QUEUE_H_ */
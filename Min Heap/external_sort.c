@@ -0,0 +1,509 @@
+/**
+ * -------------------------------------
+ * @file  external_sort.c
+ * External Sort Source Code File
+ * -------------------------------------
+ * @author Filip Stanojcic
+ *
+ * @version 2026-10-18
+ *
+ */
+#define _POSIX_C_SOURCE 200809L // mkstemp, fdopen, posix_fadvise
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+#include "external_sort.h"
+#include "min_heap.h"
+#include "kway_merge.h"
+
+/**
+ * A block read or write, done by the I/O thread.
+ */
+typedef struct external_job {
+	FILE *file;                // the file
+	int *values;               // the block
+	int count;                 // ints to write, or ints read
+	int capacity;              // most ints to read
+	int write;                 // 1 to write the block, 0 to read it
+	int done;                  // 1 once the I/O is finished
+	struct external_job *next; // next job in the queue
+} external_job;
+
+/**
+ * The I/O thread and its queue of jobs, done in order.
+ */
+typedef struct {
+	pthread_t thread;        // the I/O thread
+	int started;             // 0 if the thread could not start
+	pthread_mutex_t lock;    // guards everything below
+	pthread_cond_t queued;   // signalled when a job is queued
+	pthread_cond_t finished; // signalled when a job is done
+	external_job *head;      // first job in the queue
+	external_job *tail;      // last job in the queue
+	int stop;                // 1 when the thread should end
+	int error;               // 1 if a read or write failed
+} external_io;
+
+/**
+ * A run being merged: one block is copied out to the merge while the
+ * I/O thread reads the run's next block into the other.
+ */
+typedef struct {
+	external_io *io;      // the I/O thread
+	external_job jobs[2]; // the two blocks
+	int current;          // the block to merge next
+} external_reader;
+
+/**
+ * The output of a merge: one block is filled by the merge while the I/O
+ * thread writes the other.
+ */
+typedef struct {
+	external_io *io;      // the I/O thread
+	external_job jobs[2]; // the two blocks
+	int current;          // the block being filled
+} external_writer;
+
+// local functions
+
+/**
+ * Does the read or write of a job.
+ *
+ * @param io - pointer to the I/O thread
+ * @param job - the job
+ */
+static void external_job_run(external_io *io, external_job *job) {
+
+	if (job->write) {
+		int written = (int) fwrite(job->values, sizeof *job->values,
+				job->count, job->file);
+
+		if (written < job->count) {
+			io->error = 1;
+		}
+	} else {
+		job->count = (int) fread(job->values, sizeof *job->values,
+				job->capacity, job->file);
+
+		if (ferror(job->file)) {
+			io->error = 1;
+		}
+	}
+	return;
+}
+
+/**
+ * The I/O thread: does queued jobs in order until told to stop.
+ *
+ * @param arg - pointer to the external_io
+ * @return - NULL
+ */
+static void* external_io_thread(void *arg) {
+	external_io *io = arg;
+
+	pthread_mutex_lock(&io->lock);
+
+	while (io->head != NULL || !io->stop) {
+
+		if (io->head == NULL) {
+			pthread_cond_wait(&io->queued, &io->lock);
+		} else {
+			external_job *job = io->head;
+			io->head = job->next;
+			io->tail = io->head == NULL ? NULL : io->tail;
+			pthread_mutex_unlock(&io->lock);
+
+			external_job_run(io, job);
+
+			pthread_mutex_lock(&io->lock);
+			job->done = 1;
+			pthread_cond_broadcast(&io->finished);
+		}
+	}
+	pthread_mutex_unlock(&io->lock);
+	return NULL;
+}
+
+/**
+ * Starts the I/O thread.
+ *
+ * @param io - pointer to an external_io
+ */
+static void external_io_start(external_io *io) {
+	pthread_mutex_init(&io->lock, NULL);
+	pthread_cond_init(&io->queued, NULL);
+	pthread_cond_init(&io->finished, NULL);
+	io->head = NULL;
+	io->tail = NULL;
+	io->stop = 0;
+	io->error = 0;
+	io->started = pthread_create(&io->thread, NULL, external_io_thread, io)
+			== 0;
+	return;
+}
+
+/**
+ * Stops the I/O thread once its queue is empty.
+ *
+ * @param io - pointer to an external_io
+ */
+static void external_io_stop(external_io *io) {
+
+	if (io->started) {
+		pthread_mutex_lock(&io->lock);
+		io->stop = 1;
+		pthread_cond_signal(&io->queued);
+		pthread_mutex_unlock(&io->lock);
+		pthread_join(io->thread, NULL);
+	}
+	pthread_cond_destroy(&io->finished);
+	pthread_cond_destroy(&io->queued);
+	pthread_mutex_destroy(&io->lock);
+	return;
+}
+
+/**
+ * Queues a job for the I/O thread, or does it at once if there is no
+ * thread.
+ *
+ * @param io - pointer to the I/O thread
+ * @param job - the job
+ */
+static void external_io_submit(external_io *io, external_job *job) {
+	job->done = 0;
+	job->next = NULL;
+
+	if (!io->started) {
+		external_job_run(io, job);
+		job->done = 1;
+	} else {
+		pthread_mutex_lock(&io->lock);
+
+		if (io->tail == NULL) {
+			io->head = job;
+		} else {
+			io->tail->next = job;
+		}
+		io->tail = job;
+		pthread_cond_signal(&io->queued);
+		pthread_mutex_unlock(&io->lock);
+	}
+	return;
+}
+
+/**
+ * Waits for a job to be done.
+ *
+ * @param io - pointer to the I/O thread
+ * @param job - the job
+ */
+static void external_io_wait(external_io *io, external_job *job) {
+	pthread_mutex_lock(&io->lock);
+
+	while (!job->done) {
+		pthread_cond_wait(&io->finished, &io->lock);
+	}
+	pthread_mutex_unlock(&io->lock);
+	return;
+}
+
+/**
+ * Tells the kernel a file is read or written front to back.
+ *
+ * @param file - the file
+ */
+static void external_sequential(FILE *file) {
+#ifdef POSIX_FADV_SEQUENTIAL
+	posix_fadvise(fileno(file), 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+	return;
+}
+
+/**
+ * Creates a temporary file in directory and removes its name, so it is
+ * deleted when closed.
+ *
+ * @param directory - the directory
+ * @return - the file open for writing and reading, NULL on failure
+ */
+static FILE* external_temp(const char *directory) {
+	size_t length = strlen(directory) + sizeof "/external_XXXXXX";
+	char *path = malloc(length);
+	FILE *file = NULL;
+
+	snprintf(path, length, "%s/external_XXXXXX", directory);
+	int fd = mkstemp(path);
+
+	if (fd >= 0) {
+		unlink(path);
+		file = fdopen(fd, "w+b");
+
+		if (file == NULL) {
+			close(fd);
+		} else {
+			external_sequential(file);
+		}
+	}
+	free(path);
+	return file;
+}
+
+/**
+ * A kway_read for a run: waits for the run's current block, copies it
+ * out and has the I/O thread read the next block into it.
+ *
+ * @param state - pointer to an external_reader
+ * @param buffer - array of capacity values
+ * @param capacity - most values to read, the block capacity
+ * @return - number of values read, 0 at the end of the run
+ */
+static int external_read(void *state, int *buffer, int capacity) {
+	external_reader *reader = state;
+	external_job *job = &reader->jobs[reader->current];
+
+	external_io_wait(reader->io, job);
+	int count = job->count < capacity ? job->count : capacity;
+	memcpy(buffer, job->values, count * sizeof *buffer);
+
+	if (count > 0) {
+		external_io_submit(reader->io, job);
+		reader->current = 1 - reader->current;
+	}
+	return count;
+}
+
+/**
+ * A kway_emit for the output: copies values into the current block, and
+ * when it fills hands it to the I/O thread and fills the other.
+ *
+ * @param state - pointer to an external_writer
+ * @param values - the values
+ * @param count - number of values in values
+ */
+static void external_write(void *state, const int *values, int count) {
+	external_writer *writer = state;
+
+	while (count > 0) {
+		external_job *job = &writer->jobs[writer->current];
+		int room = job->capacity - job->count;
+		int copied = count < room ? count : room;
+
+		memcpy(job->values + job->count, values, copied * sizeof *values);
+		job->count += copied;
+		values += copied;
+		count -= copied;
+
+		if (job->count == job->capacity) {
+			external_io_submit(writer->io, job);
+			writer->current = 1 - writer->current;
+			job = &writer->jobs[writer->current];
+			external_io_wait(writer->io, job);
+			job->count = 0;
+		}
+	}
+	return;
+}
+
+/**
+ * Merges sorted runs into output through the I/O thread.
+ *
+ * @param io - pointer to the I/O thread
+ * @param runs - the run files, written and not yet rewound
+ * @param count - number of runs
+ * @param output - the file to write, at the position to write from
+ * @param budget - most bytes of memory to use
+ */
+static void external_merge(external_io *io, FILE **runs, int count,
+		FILE *output, size_t budget) {
+	// Two blocks for every run and its kway_merge buffer, and two for the
+	// output.
+	size_t blocks = budget / (sizeof(int) * (3 * (size_t) count + 2));
+	int block = blocks > EXTERNAL_BLOCK_MAX ? EXTERNAL_BLOCK_MAX :
+			blocks < 1 ? 1 : (int) blocks;
+	external_reader *readers = malloc(count * sizeof *readers);
+	external_writer writer;
+	kway_merge *merge = kway_merge_initialize(0);
+
+	for (int r = 0; r < count; r++) {
+		fflush(runs[r]);
+		rewind(runs[r]);
+		readers[r].io = io;
+		readers[r].current = 0;
+
+		for (int b = 0; b < 2; b++) {
+			readers[r].jobs[b].file = runs[r];
+			readers[r].jobs[b].values = malloc(block * sizeof(int));
+			readers[r].jobs[b].count = 0;
+			readers[r].jobs[b].capacity = block;
+			readers[r].jobs[b].write = 0;
+		}
+		kway_merge_add_reader(merge, external_read, &readers[r], block);
+	}
+	// Read ahead the first block of every run, then the second.
+	for (int b = 0; b < 2; b++) {
+
+		for (int r = 0; r < count; r++) {
+			external_io_submit(io, &readers[r].jobs[b]);
+		}
+	}
+	writer.io = io;
+	writer.current = 0;
+
+	for (int b = 0; b < 2; b++) {
+		writer.jobs[b].file = output;
+		writer.jobs[b].values = malloc(block * sizeof(int));
+		writer.jobs[b].count = 0;
+		writer.jobs[b].capacity = block;
+		writer.jobs[b].write = 1;
+		writer.jobs[b].done = 1;
+	}
+	// The loser tree is no slower than the heap at the run counts merged here.
+	kway_merge_tree(merge, external_write, &writer);
+
+	if (writer.jobs[writer.current].count > 0) {
+		external_io_submit(io, &writer.jobs[writer.current]);
+	}
+	for (int b = 0; b < 2; b++) {
+		external_io_wait(io, &writer.jobs[b]);
+		free(writer.jobs[b].values);
+	}
+	for (int r = 0; r < count; r++) {
+		// A run's last block may still be in the queue.
+		for (int b = 0; b < 2; b++) {
+			external_io_wait(io, &readers[r].jobs[b]);
+			free(readers[r].jobs[b].values);
+		}
+	}
+	fflush(output);
+	kway_merge_free(&merge);
+	free(readers);
+	return;
+}
+
+// Public external sort functions
+
+long external_sort(const char *input, const char *output, size_t budget,
+		const char *directory) {
+	budget = budget > 0 ? budget : EXTERNAL_BUDGET;
+
+	if (directory == NULL) {
+		directory = getenv("TMPDIR") != NULL ? getenv("TMPDIR") : "/tmp";
+	}
+	// heap_sort needs a buffer as large as the run.
+	size_t fits = budget / (2 * sizeof(int));
+	int capacity = fits > EXTERNAL_RUN_MAX ? EXTERNAL_RUN_MAX :
+			fits < 1 ? 1 : (int) fits;
+	// Most runs one merge can take while keeping EXTERNAL_BLOCK_MIN
+	// ints per block.
+	size_t most = budget / (3 * sizeof(int) * EXTERNAL_BLOCK_MIN);
+	int fan_in = most < 3 ? 2 : most > 4096 ? 4096 : (int) most - 1;
+	FILE *in = fopen(input, "rb");
+	FILE **runs = NULL;
+	int count = 0;
+	int allocated = 0;
+	int direct = 0;
+	int error = in == NULL;
+	long sorted = 0;
+
+	if (!error) {
+		external_sequential(in);
+		int *values = malloc(capacity * sizeof *values);
+		int read = capacity;
+
+		// Cut the input into sorted runs. An input that fits in one run
+		// is sorted straight to output.
+		while (!error && read == capacity) {
+			read = (int) fread(values, sizeof *values, capacity, in);
+			error = ferror(in);
+			heap_sort(values, read);
+			sorted += read;
+
+			if (!error && (read > 0 || count == 0)) {
+				FILE *run = NULL;
+
+				if (count == 0 && read < capacity) {
+					fclose(in);
+					in = NULL;
+					run = fopen(output, "wb");
+					// Only an opened output holds the run: runs[0] is not
+					// set otherwise.
+					direct = run != NULL;
+				} else {
+					run = external_temp(directory);
+				}
+				error = run == NULL;
+
+				if (!error) {
+					error = (int) fwrite(values, sizeof *values, read, run)
+							< read;
+
+					if (count == allocated) {
+						allocated = allocated == 0 ? 16 : allocated * 2;
+						runs = realloc(runs, allocated * sizeof *runs);
+					}
+					runs[count] = run;
+					count++;
+				}
+			}
+		}
+		free(values);
+
+		if (in != NULL) {
+			fclose(in);
+		}
+	}
+	if (direct) {
+		// The input fit in one run, already written to output.
+		error = fclose(runs[0]) != 0 || error;
+		runs[0] = NULL;
+	} else if (!error) {
+		external_io io;
+		external_io_start(&io);
+
+		// Merge groups of fan_in runs into longer runs until one merge
+		// can take them all.
+		while (!error && count > fan_in) {
+			int merged = 0;
+
+			for (int first = 0; !error && first < count; first += fan_in) {
+				int group = count - first < fan_in ? count - first : fan_in;
+				FILE *run = external_temp(directory);
+				error = run == NULL;
+
+				if (!error) {
+					external_merge(&io, runs + first, group, run, budget);
+				}
+				for (int r = first; r < first + group; r++) {
+					fclose(runs[r]);
+					runs[r] = NULL;
+				}
+				runs[merged] = run;
+				merged++;
+			}
+			// On error the runs not yet merged are left to close.
+			error = error || io.error;
+			count = error ? count : merged;
+		}
+		FILE *out = error ? NULL : fopen(output, "wb");
+		error = error || out == NULL;
+
+		if (!error) {
+			external_sequential(out);
+			external_merge(&io, runs, count, out, budget);
+			error = fclose(out) != 0 || io.error;
+		}
+		external_io_stop(&io);
+	}
+	for (int r = 0; r < count; r++) {
+
+		if (runs[r] != NULL) {
+			fclose(runs[r]);
+		}
+	}
+	free(runs);
+	return error ? -1 : sorted;
+}
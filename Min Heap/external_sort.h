@@ -0,0 +1,52 @@
+/**
+ * -------------------------------------
+ * @file  external_sort.h
+ * External Sort Header File
+ * -------------------------------------
+ * @author Filip Stanojcic
+ *
+ * @version 2026-10-18
+ *
+ * Sorts a binary file of native ints that may be far larger than memory.
+ * The input is read in runs as large as the memory budget allows, each
+ * run is sorted by heap_sort and written to a temporary file, and the
+ * runs are then merged by kway_merge into the output. A run is merged
+ * from two blocks: one is being merged while an I/O thread reads the
+ * next into the other, and the output is written behind the same way.
+ * When there are more runs than the budget has blocks for, groups of
+ * runs are merged into longer runs first.
+ *
+ * Memory in use stays within the budget, apart from a few fixed-size
+ * buffers: a run needs two ints of memory for every int of run (heap_sort
+ * sorts through a buffer), and a merge of k runs needs 3k + 2 blocks.
+ */
+#ifndef EXTERNAL_SORT_H_
+#define EXTERNAL_SORT_H_
+
+// Includes
+#include <stdio.h>
+#include <stdlib.h>
+
+#define EXTERNAL_BUDGET ((size_t) 1 << 28) // Default memory budget, bytes
+#define EXTERNAL_BLOCK_MIN (1 << 16) // Fewest ints per merge block to aim for
+#define EXTERNAL_BLOCK_MAX (1 << 22) // Most ints per merge block
+#define EXTERNAL_RUN_MAX (1 << 30)   // Most ints per run
+
+// Prototypes
+
+/**
+ * Sorts a binary file of native ints into another. A partial int at the
+ * end of input is ignored. Temporary files are removed from directory
+ * as soon as they are created, so none are left behind.
+ *
+ * @param input - path of the file to sort
+ * @param output - path of the sorted file, may be input
+ * @param budget - most bytes of memory to use, EXTERNAL_BUDGET if 0
+ * @param directory - directory for temporary files, TMPDIR or /tmp if NULL
+ * @return - number of ints sorted, -1 if a file could not be opened,
+ * read or written
+ */
+long external_sort(const char *input, const char *output, size_t budget,
+        const char *directory);
+
+#endif /* EXTERNAL_SORT_H_ */
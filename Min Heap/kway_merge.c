@@ -0,0 +1,223 @@
+/**
+ * -------------------------------------
+ * @file  kway_merge.c
+ * K-Way Merge Source Code File
+ * -------------------------------------
+ * @author Filip Stanojcic
+ *
+ * @version 2026-10-18
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "kway_merge.h"
+#include "priority_queue.h"
+
+// Priority queue key of a value: negated for a max queue, so the smallest
+// value still comes out first. pq_key is wider than int, so none overflow.
+#ifdef PQ_MAX
+#define KWAY_KEY(value) (-(pq_key) (value))
+#else
+#define KWAY_KEY(value) ((pq_key) (value))
+#endif
+
+// Loser tree key of a run with no values left: above every int.
+#define KWAY_DONE INT64_MAX
+
+// local functions
+
+/**
+ * Adds an empty run to source, doubling the capacity of its runs if they
+ * are full.
+ *
+ * @param source - pointer to a k-way merge
+ * @return - pointer to the new run
+ */
+static kway_run* kway_run_add(kway_merge *source) {
+
+	if (source->count == source->capacity) {
+		source->capacity = source->capacity == 0 ? 4 : source->capacity * 2;
+		source->runs = realloc(source->runs,
+				source->capacity * sizeof *source->runs);
+	}
+	kway_run *run = &source->runs[source->count];
+	source->count++;
+	run->values = NULL;
+	run->count = 0;
+	run->next = 0;
+	run->read = NULL;
+	run->state = NULL;
+	run->buffer = NULL;
+	run->capacity = 0;
+	return run;
+}
+
+/**
+ * Takes the next value of a run, refilling its buffer from its reader
+ * when the buffer is used up.
+ *
+ * @param run - pointer to a run
+ * @param value - set to the next value, if there is one
+ * @return - 1 if there was a next value, 0 at the end of the run
+ */
+static inline int kway_next(kway_run *run, int *value) {
+	int more = run->next < run->count;
+
+	if (!more && run->read != NULL) {
+		run->count = run->read(run->state, run->buffer, run->capacity);
+		run->next = 0;
+		more = run->count > 0;
+	}
+	if (more) {
+		*value = run->values[run->next];
+		run->next++;
+	}
+	return more;
+}
+
+// Public k-way merge functions
+
+kway_merge* kway_merge_initialize(int batch) {
+	kway_merge *source = malloc(sizeof *source);
+	source->count = 0;
+	source->capacity = 0;
+	source->batch = batch > 0 ? batch : KWAY_BATCH;
+	source->runs = NULL;
+	return source;
+}
+
+void kway_merge_free(kway_merge **source) {
+
+	for (int r = 0; r < (*source)->count; r++) {
+		free((*source)->runs[r].buffer);
+	}
+	free((*source)->runs);
+	free(*source);
+	*source = NULL;
+	return;
+}
+
+void kway_merge_add_array(kway_merge *source, const int *values, int count) {
+	kway_run *run = kway_run_add(source);
+	run->values = values;
+	run->count = count;
+	return;
+}
+
+void kway_merge_add_reader(kway_merge *source, kway_read read, void *state,
+		int capacity) {
+	kway_run *run = kway_run_add(source);
+	run->read = read;
+	run->state = state;
+	run->capacity = capacity > 0 ? capacity : KWAY_BUFFER;
+	run->buffer = malloc(run->capacity * sizeof *run->buffer);
+	run->values = run->buffer;
+	return;
+}
+
+long kway_merge_heap(kway_merge *source, kway_emit emit, void *state) {
+	priority_queue *heap = pq_initialize(source->count);
+	int *output = malloc(source->batch * sizeof *output);
+	int filled = 0;
+	long merged = 0;
+	int value;
+
+	for (int r = 0; r < source->count; r++) {
+
+		if (kway_next(&source->runs[r], &value)) {
+			pq_insert(heap, KWAY_KEY(value), r);
+		}
+	}
+	while (!pq_empty(heap)) {
+		pq_payload r;
+		output[filled] = (int) KWAY_KEY(pq_peek(heap, &r));
+		filled++;
+
+		if (filled == source->batch) {
+			emit(state, output, filled);
+			merged += filled;
+			filled = 0;
+		}
+		// The next value of the same run takes the root's place in one
+		// sift-down. An ended run leaves the queue.
+		if (kway_next(&source->runs[r], &value)) {
+			pq_replace(heap, KWAY_KEY(value), &r);
+		} else {
+			pq_remove(heap, NULL);
+		}
+	}
+	if (filled > 0) {
+		emit(state, output, filled);
+		merged += filled;
+	}
+	free(output);
+	pq_free(&heap);
+	return merged;
+}
+
+long kway_merge_tree(kway_merge *source, kway_emit emit, void *state) {
+	int k = source->count;
+	long merged = 0;
+
+	if (k > 0) {
+		// Leaf r of the tree is node k + r, and node n's children are
+		// 2n and 2n + 1, so the parent of leaf r is (k + r) / 2. Each
+		// internal node holds the run that lost the match played there.
+		int64_t *heads = malloc(k * sizeof *heads);
+		int *losers = malloc(k * sizeof *losers);
+		int *winners = malloc(2 * k * sizeof *winners);
+		int *output = malloc(source->batch * sizeof *output);
+		int filled = 0;
+		int value;
+
+		for (int r = 0; r < k; r++) {
+			heads[r] = kway_next(&source->runs[r], &value) ? value : KWAY_DONE;
+			winners[k + r] = r;
+		}
+		for (int n = k - 1; n > 0; n--) {
+			int a = winners[2 * n];
+			int b = winners[2 * n + 1];
+			int swap = heads[b] < heads[a];
+			winners[n] = swap ? b : a;
+			losers[n] = swap ? a : b;
+		}
+		int winner = winners[1];
+		free(winners);
+
+		while (heads[winner] != KWAY_DONE) {
+			output[filled] = (int) heads[winner];
+			filled++;
+
+			if (filled == source->batch) {
+				emit(state, output, filled);
+				merged += filled;
+				filled = 0;
+			}
+			heads[winner] =
+					kway_next(&source->runs[winner], &value) ? value : KWAY_DONE;
+
+			// Replay the winner's path: at each node the smaller head goes
+			// on up, and the larger stays as the loser.
+			for (int n = (k + winner) / 2; n > 0; n /= 2) {
+				int loser = losers[n];
+				int swap = heads[loser] < heads[winner];
+				losers[n] = swap ? winner : loser;
+				winner = swap ? loser : winner;
+			}
+		}
+		if (filled > 0) {
+			emit(state, output, filled);
+			merged += filled;
+		}
+		free(output);
+		free(losers);
+		free(heads);
+	}
+	return merged;
+}
+
+int kway_read_file(void *state, int *buffer, int capacity) {
+	return (int) fread(buffer, sizeof *buffer, capacity, state);
+}
@@ -0,0 +1,145 @@
+/**
+ * -------------------------------------
+ * @file  kway_merge.h
+ * K-Way Merge Header File
+ * -------------------------------------
+ * @author Filip Stanojcic
+ *
+ * @version 2026-10-18
+ *
+ * Merges k sorted runs of integers into one sorted output in O(n log k).
+ * A run is an array, or a reader that fills a buffer from a file or any
+ * other stream. Output is handed to an emit function in batches.
+ *
+ * kway_merge_heap keeps the head of every run in a priority queue and
+ * uses pq_replace to take the smallest and add the next value of its run
+ * in one sift-down. kway_merge_tree keeps them in a loser tree instead,
+ * which replays only one leaf-to-root path of log2 k comparisons per
+ * value, with no choice of child at each level. The comparisons saved
+ * barely show: merging 10^7 ints (bench_merge), the two are within about
+ * 10% of each other from 4 to 1024 runs, with neither ahead throughout.
+ * The heap is slightly faster at 4 runs, the tree at 64 to 256.
+ */
+#ifndef KWAY_MERGE_H_
+#define KWAY_MERGE_H_
+
+// Includes
+#include <stdio.h>
+#include <stdlib.h>
+
+#define KWAY_BATCH 4096    // Default values per emit
+#define KWAY_BUFFER 4096   // Default values per reader buffer
+
+/**
+ * Reads up to capacity values of a run into buffer.
+ *
+ * @param state - the reader's state
+ * @param buffer - array of capacity values
+ * @param capacity - most values to read
+ * @return - number of values read, 0 at the end of the run
+ */
+typedef int (*kway_read)(void *state, int *buffer, int capacity);
+
+/**
+ * Takes a batch of merged values.
+ *
+ * @param state - the emitter's state
+ * @param values - the values, in order
+ * @param count - number of values in values
+ */
+typedef void (*kway_emit)(void *state, const int *values, int count);
+
+/**
+ * A sorted run.
+ */
+typedef struct {
+    const int *values; // current block of the run: the array, or buffer
+    int count;         // number of values in the block
+    int next;          // index of the run's next value in the block
+    kway_read read;    // reader, NULL for an array run
+    void *state;       // state passed to read
+    int *buffer;       // read buffer, NULL for an array run
+    int capacity;      // capacity of buffer
+} kway_run;
+
+/**
+ * K-way merge header.
+ */
+typedef struct {
+    int count;      // number of runs
+    int capacity;   // current capacity of runs
+    int batch;      // values per emit
+    kway_run *runs; // the runs
+} kway_merge;
+
+// Prototypes
+
+/**
+ * Initialize a k-way merge with no runs.
+ *
+ * @param batch - values per emit, KWAY_BATCH if 0
+ * @return - pointer to a k-way merge
+ */
+kway_merge* kway_merge_initialize(int batch);
+
+/**
+ * Frees k-way merge memory. Arrays and reader states are not freed.
+ *
+ * @param source - pointer to a k-way merge
+ */
+void kway_merge_free(kway_merge **source);
+
+/**
+ * Adds a sorted array to source. The array is read in place, so must
+ * outlive the merge.
+ *
+ * @param source - pointer to a k-way merge
+ * @param values - sorted array of values
+ * @param count - number of values in values
+ */
+void kway_merge_add_array(kway_merge *source, const int *values, int count);
+
+/**
+ * Adds a sorted run read through a reader to source.
+ *
+ * @param source - pointer to a k-way merge
+ * @param read - the reader
+ * @param state - state passed to read
+ * @param capacity - values per read, KWAY_BUFFER if 0
+ */
+void kway_merge_add_reader(kway_merge *source, kway_read read, void *state,
+        int capacity);
+
+/**
+ * Merges the runs of source with a priority queue. Each run is consumed,
+ * so source can be merged once.
+ *
+ * @param source - pointer to a k-way merge
+ * @param emit - called with each batch of merged values
+ * @param state - state passed to emit
+ * @return - number of values merged
+ */
+long kway_merge_heap(kway_merge *source, kway_emit emit, void *state);
+
+/**
+ * Merges the runs of source with a loser tree. Each run is consumed, so
+ * source can be merged once.
+ *
+ * @param source - pointer to a k-way merge
+ * @param emit - called with each batch of merged values
+ * @param state - state passed to emit
+ * @return - number of values merged
+ */
+long kway_merge_tree(kway_merge *source, kway_emit emit, void *state);
+
+/**
+ * A kway_read for a FILE of native ints opened for binary reading.
+ *
+ * @param state - the FILE pointer
+ * @param buffer - array of capacity values
+ * @param capacity - most values to read
+ * @return - number of values read, 0 at the end of the file
+ */
+int kway_read_file(void *state, int *buffer, int capacity);
+
+#endif /* KWAY_MERGE_H_ */
@@ -7,14 +7,29 @@
  *
  * @version 2024-03-11
  *
+ * heap_sort uses POSIX threads for large arrays, so build with:
+ *   gcc -O2 -pthread *.c
  */
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
 
 #include "min_heap.h"
+#include "priority_queue.h"
+#include "min_heap_indexed.h"
+#include "radix_heap.h"
+#include "bucket_queue.h"
+#include "sort.h"
+#include "kway_merge.h"
+#include "external_sort.h"
 
 #define MAX_STRING 80
 #define SEP "------------------------------------------------\n"
+#define BENCH_VALUES 10000000 // Values in the benchmark heap
+#define BENCH_GRID 1000          // Rows and columns of the benchmark grid graph
+#define BENCH_WEIGHT 100         // Largest edge weight of the grid graph
 
 /**
  * Simple heap testing.
@@ -73,6 +88,585 @@ void test_heap(void) {
 
 }
 
+/**
+ * Shows a heap growing from a capacity of 1 as values are inserted, and
+ * shrinking again as they are removed.
+ */
+void test_heap_grow(void) {
+    min_heap *source = min_heap_initialize(1);
+
+    for(int i = 1000; i > 0; i--) {
+        min_heap_insert(source, i);
+    }
+    printf("count: %d, capacity: %d\n", min_heap_count(source),
+            source->capacity);
+
+    while(min_heap_count(source) > 10) {
+        min_heap_remove(source);
+    }
+    printf("count: %d, capacity: %d\n", min_heap_count(source),
+            source->capacity);
+    min_heap_reserve(source, 5000);
+    printf("after reserve capacity: %d, valid: %d\n", source->capacity,
+            min_heap_valid(source));
+    min_heap_free(&source);
+    printf(SEP);
+}
+
+/**
+ * Times building a heap with one insert per value, into a heap sized in
+ * advance and into one that grows, against min_heap_heapify.
+ *
+ * @param name - name of the input
+ * @param values - array of BENCH_VALUES values
+ */
+static void bench_heapify_values(const char *name, int *values) {
+    min_heap *source = min_heap_initialize(BENCH_VALUES);
+    clock_t start = clock();
+
+    for(int i = 0; i < BENCH_VALUES; i++) {
+        min_heap_insert(source, values[i]);
+    }
+    double insert_time = (double) (clock() - start) / CLOCKS_PER_SEC;
+    min_heap_free(&source);
+    source = min_heap_initialize(HEAP_INIT);
+    start = clock();
+
+    for(int i = 0; i < BENCH_VALUES; i++) {
+        min_heap_insert(source, values[i]);
+    }
+    double grow_time = (double) (clock() - start) / CLOCKS_PER_SEC;
+    min_heap_free(&source);
+    source = min_heap_initialize(HEAP_INIT);
+    start = clock();
+    min_heap_heapify(source, values, BENCH_VALUES);
+    double heapify_time = (double) (clock() - start) / CLOCKS_PER_SEC;
+    printf("%-10s  %7.3f  %7.3f  %7.3f  %d\n", name, insert_time, grow_time,
+            heapify_time, min_heap_valid(source));
+    min_heap_free(&source);
+}
+
+/**
+ * Compares insert and heapify on random and descending values, the worst
+ * case for insert.
+ */
+void bench_heapify(void) {
+    int *values = malloc(BENCH_VALUES * sizeof *values);
+    unsigned int seed = 1;
+
+    printf("%d values (seconds)\n", BENCH_VALUES);
+    printf("values       insert  growing  heapify  valid\n");
+
+    for(int i = 0; i < BENCH_VALUES; i++) {
+        seed = seed * 1103515245 + 12345;
+        values[i] = (int) (seed >> 1);
+    }
+    bench_heapify_values("random", values);
+
+    for(int i = 0; i < BENCH_VALUES; i++) {
+        values[i] = BENCH_VALUES - i;
+    }
+    bench_heapify_values("descending", values);
+    free(values);
+}
+
+/**
+ * Times removing every value from a heap much larger than the L2 cache.
+ * Build with -DHEAP_ARITY=2, 4 or 8 to compare arities.
+ */
+void bench_remove(void) {
+    int *values = malloc(BENCH_VALUES * sizeof *values);
+    unsigned int seed = 3;
+
+    for(int i = 0; i < BENCH_VALUES; i++) {
+        seed = seed * 1103515245 + 12345;
+        values[i] = (int) (seed >> 1);
+    }
+    min_heap *source = min_heap_initialize(HEAP_INIT);
+    min_heap_heapify(source, values, BENCH_VALUES);
+    clock_t start = clock();
+    int ordered = 1;
+    int previous = min_heap_remove(source);
+
+    while(!min_heap_empty(source)) {
+        int value = min_heap_remove(source);
+        ordered = ordered && previous <= value;
+        previous = value;
+    }
+    double remove_time = (double) (clock() - start) / CLOCKS_PER_SEC;
+    printf("arity %d: %d removes %.3fs, in order: %d\n", HEAP_ARITY,
+            BENCH_VALUES, remove_time, ordered);
+    min_heap_free(&source);
+    free(values);
+}
+
+/**
+ * Simple priority queue testing: vertices keyed by distance.
+ */
+void test_priority_queue(void) {
+    pq_key distances[] = {11, 7, 15, 6, 9, 12, 18, 8};
+    pq_payload vertices[] = {0, 1, 2, 3, 4, 5, 6, 7};
+    int count = sizeof distances / sizeof *distances;
+    priority_queue *source = pq_initialize(1);
+
+    for(int i = 0; i < count; i++) {
+        pq_insert(source, distances[i], vertices[i]);
+    }
+    pq_print(source);
+    printf("Remove all (distance: vertex):\n");
+
+    while(!pq_empty(source)) {
+        pq_payload vertex = 0;
+        pq_key distance = pq_remove(source, &vertex);
+        printf("%d: %d, ", (int) distance, (int) vertex);
+    }
+    printf("\n");
+    pq_heapify(source, distances, vertices, count);
+    pq_payload vertex = 8;
+    pq_key distance = pq_replace(source, 13, &vertex);
+    printf("Replaced %d: %d with 13: 8, ", (int) distance, (int) vertex);
+    distance = pq_peek(source, &vertex);
+    printf("first now %d: %d, valid: %d\n", (int) distance, (int) vertex,
+            pq_valid(source));
+    pq_free(&source);
+    printf(SEP);
+}
+
+/**
+ * Simple indexed heap testing: ids 0 to 7 keyed by distance, some of
+ * which change while in the heap.
+ */
+void test_heap_indexed(void) {
+    int distances[] = {11, 7, 15, 6, 9, 12, 18, 8};
+    int count = sizeof distances / sizeof *distances;
+    min_heap_indexed *source = min_heap_indexed_initialize(count);
+
+    for(int id = 0; id < count; id++) {
+        min_heap_indexed_insert(source, id, distances[id]);
+    }
+    min_heap_indexed_decrease_key(source, 6, 1);
+    min_heap_indexed_increase_key(source, 3, 20);
+    int deleted = min_heap_indexed_delete(source, 1);
+    printf("deleted 1: %d, contains 1: %d, valid: %d\n", deleted,
+            min_heap_indexed_contains(source, 1),
+            min_heap_indexed_valid(source));
+    printf("Remove all (id: key):\n");
+
+    while(!min_heap_indexed_empty(source)) {
+        int id = 0;
+        int key = min_heap_indexed_remove(source, &id);
+        printf("%d: %d, ", id, key);
+    }
+    printf("\n");
+    min_heap_indexed_free(&source);
+    printf(SEP);
+}
+
+/**
+ * A graph in compressed form: the arcs out of node u are first[u] to
+ * first[u + 1] - 1.
+ */
+typedef struct {
+    int nodes;    // number of nodes
+    int *first;   // index of the first arc out of each node, nodes + 1
+    int *targets; // node each arc goes to
+    int *weights; // weight of each arc
+} bench_graph;
+
+/**
+ * Builds a grid of BENCH_GRID x BENCH_GRID nodes, each joined to its four
+ * neighbours by roads of random weight 1 to BENCH_WEIGHT, with every tenth
+ * row and column a faster highway: a rough road network.
+ *
+ * @param graph - the graph to build
+ */
+static void bench_grid(bench_graph *graph) {
+    int n = BENCH_GRID * BENCH_GRID;
+    unsigned int seed = 11;
+    graph->nodes = n;
+    graph->first = malloc((n + 1) * sizeof *graph->first);
+    graph->targets = malloc(4 * n * sizeof *graph->targets);
+    graph->weights = malloc(4 * n * sizeof *graph->weights);
+    int arcs = 0;
+
+    for(int u = 0; u < n; u++) {
+        int row = u / BENCH_GRID;
+        int column = u % BENCH_GRID;
+        int neighbours[] = {row > 0 ? u - BENCH_GRID : -1,
+                row < BENCH_GRID - 1 ? u + BENCH_GRID : -1,
+                column > 0 ? u - 1 : -1,
+                column < BENCH_GRID - 1 ? u + 1 : -1};
+        graph->first[u] = arcs;
+
+        for(int k = 0; k < 4; k++) {
+            if(neighbours[k] >= 0) {
+                seed = seed * 1103515245 + 12345;
+                int weight = 1 + (seed >> 16) % BENCH_WEIGHT;
+                // Roads along a highway row (k >= 2) or column (k < 2).
+                if((k >= 2 && row % 10 == 0) || (k < 2 && column % 10 == 0)) {
+                    weight = 1 + weight / 10;
+                }
+                graph->targets[arcs] = neighbours[k];
+                graph->weights[arcs] = weight;
+                arcs++;
+            }
+        }
+    }
+    graph->first[n] = arcs;
+}
+
+/**
+ * Runs Dijkstra's algorithm from node 0 with an indexed heap, lowering the
+ * key of a node already in the heap.
+ *
+ * @param graph - the graph
+ * @param labels - set to the distance of each node from node 0
+ */
+static void bench_dijkstra_heap(const bench_graph *graph, int *labels) {
+    min_heap_indexed *queue = min_heap_indexed_initialize(graph->nodes);
+    labels[0] = 0;
+    min_heap_indexed_insert(queue, 0, 0);
+
+    while(!min_heap_indexed_empty(queue)) {
+        int u = 0;
+        int label = min_heap_indexed_remove(queue, &u);
+
+        for(int a = graph->first[u]; a < graph->first[u + 1]; a++) {
+            int v = graph->targets[a];
+
+            if(label + graph->weights[a] < labels[v]) {
+                labels[v] = label + graph->weights[a];
+
+                if(min_heap_indexed_contains(queue, v)) {
+                    min_heap_indexed_decrease_key(queue, v, labels[v]);
+                } else {
+                    min_heap_indexed_insert(queue, v, labels[v]);
+                }
+            }
+        }
+    }
+    min_heap_indexed_free(&queue);
+}
+
+/**
+ * Runs Dijkstra's algorithm from node 0 with a radix heap, inserting a
+ * node again when its label improves and skipping the stale copies.
+ *
+ * @param graph - the graph
+ * @param labels - set to the distance of each node from node 0
+ */
+static void bench_dijkstra_radix(const bench_graph *graph, int *labels) {
+    radix_heap *queue = radix_heap_initialize();
+    labels[0] = 0;
+    radix_heap_insert(queue, 0, 0);
+
+    while(!radix_heap_empty(queue)) {
+        int u = 0;
+        int label = (int) radix_heap_remove(queue, &u);
+
+        if(label == labels[u]) {
+            for(int a = graph->first[u]; a < graph->first[u + 1]; a++) {
+                int v = graph->targets[a];
+
+                if(label + graph->weights[a] < labels[v]) {
+                    labels[v] = label + graph->weights[a];
+                    radix_heap_insert(queue, labels[v], v);
+                }
+            }
+        }
+    }
+    radix_heap_free(&queue);
+}
+
+/**
+ * Runs Dijkstra's algorithm from node 0 with Dial's bucket queue,
+ * inserting a node again when its label improves and skipping the stale
+ * copies.
+ *
+ * @param graph - the graph
+ * @param labels - set to the distance of each node from node 0
+ */
+static void bench_dijkstra_dial(const bench_graph *graph, int *labels) {
+    bucket_queue *queue = bucket_queue_initialize(BENCH_WEIGHT);
+    labels[0] = 0;
+    bucket_queue_insert(queue, 0, 0);
+
+    while(!bucket_queue_empty(queue)) {
+        int u = 0;
+        int label = bucket_queue_remove(queue, &u);
+
+        if(label == labels[u]) {
+            for(int a = graph->first[u]; a < graph->first[u + 1]; a++) {
+                int v = graph->targets[a];
+
+                if(label + graph->weights[a] < labels[v]) {
+                    labels[v] = label + graph->weights[a];
+                    bucket_queue_insert(queue, labels[v], v);
+                }
+            }
+        }
+    }
+    bucket_queue_free(&queue);
+}
+
+/**
+ * Times Dijkstra's algorithm on a grid graph with each queue. The three
+ * runs are copies of spt_dijkstra_queue in "Prim's and Dijkstra's/
+ * algorithm.c" on a compact graph, to time the queues alone: the main.c
+ * there times the real function on the same grid, and both print the
+ * same sum of distances.
+ */
+void bench_dijkstra(void) {
+    bench_graph graph;
+    bench_grid(&graph);
+    int *labels = malloc(graph.nodes * sizeof *labels);
+    void (*runs[])(const bench_graph*, int*) = {bench_dijkstra_heap,
+            bench_dijkstra_radix, bench_dijkstra_dial};
+    const char *names[] = {"indexed heap", "radix heap", "dial buckets"};
+
+    printf("Dijkstra on a %dx%d grid (seconds)\n", BENCH_GRID, BENCH_GRID);
+
+    for(int r = 0; r < 3; r++) {
+        for(int u = 0; u < graph.nodes; u++) {
+            labels[u] = BENCH_WEIGHT * graph.nodes;
+        }
+        clock_t start = clock();
+        runs[r](&graph, labels);
+        double seconds = (double) (clock() - start) / CLOCKS_PER_SEC;
+        long total = 0;
+
+        for(int u = 0; u < graph.nodes; u++) {
+            total += labels[u];
+        }
+        printf("%-12s  %7.3f  sum of distances: %ld\n", names[r], seconds,
+                total);
+    }
+    free(labels);
+    free(graph.first);
+    free(graph.targets);
+    free(graph.weights);
+}
+
+/**
+ * Compares integers without the overflow of subtracting them.
+ *
+ * @param a - pointer to an int
+ * @param b - pointer to an int
+ * @return - < 0, 0 or > 0 as a is less than, equal to or greater than b
+ */
+static int bench_compare(const void *a, const void *b) {
+    int x = *(const int*) a;
+    int y = *(const int*) b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * Times qsort against each sort in sort.h on the same random values, and
+ * checks every result against qsort's.
+ */
+void bench_sort(void) {
+    int *values = malloc(BENCH_VALUES * sizeof *values);
+    int *sorted = malloc(BENCH_VALUES * sizeof *sorted);
+    int *copy = malloc(BENCH_VALUES * sizeof *copy);
+    int64_t *wide = malloc(BENCH_VALUES * sizeof *wide);
+    unsigned int seed = 7;
+
+    for(int i = 0; i < BENCH_VALUES; i++) {
+        seed = seed * 1103515245 + 12345;
+        values[i] = (int) (seed ^ (seed << 16));
+    }
+    memcpy(sorted, values, BENCH_VALUES * sizeof *values);
+    clock_t start = clock();
+    qsort(sorted, BENCH_VALUES, sizeof *sorted, bench_compare);
+    printf("%d values (seconds)\n", BENCH_VALUES);
+    printf("%-12s  %7.3f\n", "qsort", (double) (clock() - start) / CLOCKS_PER_SEC);
+    void (*sorts[])(int*, int) = {sort_heap, sort_radix, heap_sort};
+    const char *names[] = {"heapsort", "radix", "heap_sort"};
+
+    for(int r = 0; r < 3; r++) {
+        memcpy(copy, values, BENCH_VALUES * sizeof *values);
+        start = clock();
+        sorts[r](copy, BENCH_VALUES);
+        double seconds = (double) (clock() - start) / CLOCKS_PER_SEC;
+        printf("%-12s  %7.3f  same as qsort: %d\n", names[r], seconds,
+                memcmp(copy, sorted, BENCH_VALUES * sizeof *copy) == 0);
+    }
+    for(int i = 0; i < BENCH_VALUES; i++) {
+        wide[i] = (int64_t) values[i] * 4294967296 + i;
+    }
+    start = clock();
+    sort_radix64(wide, BENCH_VALUES);
+    double seconds = (double) (clock() - start) / CLOCKS_PER_SEC;
+    int ordered = 1;
+
+    for(int i = 1; i < BENCH_VALUES; i++) {
+        ordered = ordered && wide[i - 1] < wide[i];
+    }
+    printf("%-12s  %7.3f  ordered: %d\n", "radix64", seconds, ordered);
+    free(wide);
+    free(copy);
+    free(sorted);
+    free(values);
+}
+
+/**
+ * Output of a benchmark merge.
+ */
+typedef struct {
+    int *values; // the merged values
+    long count;  // number of values merged so far
+} bench_sink;
+
+/**
+ * A kway_emit that appends each batch to a bench_sink.
+ *
+ * @param state - pointer to a bench_sink
+ * @param values - the batch
+ * @param count - number of values in the batch
+ */
+static void bench_emit(void *state, const int *values, int count) {
+    bench_sink *sink = state;
+    memcpy(sink->values + sink->count, values, count * sizeof *values);
+    sink->count += count;
+}
+
+/**
+ * Times merging sorted runs with the priority queue and the loser tree
+ * against concatenating them and calling heap_sort, for several numbers
+ * of runs of BENCH_VALUES values in all.
+ */
+void bench_merge(void) {
+    int *values = malloc(BENCH_VALUES * sizeof *values);
+    int *sorted = malloc(BENCH_VALUES * sizeof *sorted);
+    int *copy = malloc(BENCH_VALUES * sizeof *copy);
+    bench_sink sink = {malloc(BENCH_VALUES * sizeof *sink.values), 0};
+    unsigned int seed = 11;
+
+    for(int i = 0; i < BENCH_VALUES; i++) {
+        seed = seed * 1103515245 + 12345;
+        values[i] = (int) (seed ^ (seed << 16));
+    }
+    memcpy(sorted, values, BENCH_VALUES * sizeof *values);
+    heap_sort(sorted, BENCH_VALUES);
+    printf("%d values (seconds)\n", BENCH_VALUES);
+    printf("%6s  %9s  %7s  %7s\n", "runs", "heap_sort", "heap", "tree");
+    int runs[] = {4, 16, 64, 256, 1024};
+
+    for(int k = 0; k < 5; k++) {
+        // Runs of equal length, each sorted.
+        for(int r = 0; r < runs[k]; r++) {
+            int first = (long) BENCH_VALUES * r / runs[k];
+            int last = (long) BENCH_VALUES * (r + 1) / runs[k];
+            heap_sort(values + first, last - first);
+        }
+        memcpy(copy, values, BENCH_VALUES * sizeof *values);
+        clock_t start = clock();
+        heap_sort(copy, BENCH_VALUES);
+        double sorting = (double) (clock() - start) / CLOCKS_PER_SEC;
+        double seconds[2];
+        int same = 1;
+
+        for(int m = 0; m < 2; m++) {
+            kway_merge *merge = kway_merge_initialize(0);
+
+            for(int r = 0; r < runs[k]; r++) {
+                int first = (long) BENCH_VALUES * r / runs[k];
+                int last = (long) BENCH_VALUES * (r + 1) / runs[k];
+                kway_merge_add_array(merge, values + first, last - first);
+            }
+            sink.count = 0;
+            start = clock();
+
+            if (m == 0) {
+                kway_merge_heap(merge, bench_emit, &sink);
+            } else {
+                kway_merge_tree(merge, bench_emit, &sink);
+            }
+            seconds[m] = (double) (clock() - start) / CLOCKS_PER_SEC;
+            same = same && sink.count == BENCH_VALUES
+                    && memcmp(sink.values, sorted,
+                            BENCH_VALUES * sizeof *sorted) == 0;
+            kway_merge_free(&merge);
+        }
+        printf("%6d  %9.3f  %7.3f  %7.3f  same as heap_sort: %d\n", runs[k],
+                sorting, seconds[0], seconds[1], same);
+    }
+    free(sink.values);
+    free(copy);
+    free(sorted);
+    free(values);
+}
+
+/**
+ * Returns wall clock time, which unlike clock() does not add up the time
+ * of every thread or leave out time waiting on the disk.
+ *
+ * @return - seconds
+ */
+static double wall_time(void) {
+    struct timespec now;
+    timespec_get(&now, TIME_UTC);
+    return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+/**
+ * Writes BENCH_VALUES random ints to a file in TMPDIR or /tmp and sorts it
+ * with external_sort under several memory budgets: the smallest needs two
+ * merge passes, the next one, and the largest fits the input in one run.
+ * Checks every output against heap_sort.
+ */
+void test_external_sort(void) {
+    const char *directory = getenv("TMPDIR") != NULL ? getenv("TMPDIR") : "/tmp";
+    char input[MAX_STRING];
+    char output[MAX_STRING];
+    int *values = malloc(BENCH_VALUES * sizeof *values);
+    int *sorted = malloc(BENCH_VALUES * sizeof *sorted);
+    unsigned int seed = 13;
+
+    snprintf(input, sizeof input, "%s/external_input.bin", directory);
+    snprintf(output, sizeof output, "%s/external_output.bin", directory);
+
+    for(int i = 0; i < BENCH_VALUES; i++) {
+        seed = seed * 1103515245 + 12345;
+        values[i] = (int) (seed ^ (seed << 16));
+    }
+    FILE *file = fopen(input, "wb");
+    fwrite(values, sizeof *values, BENCH_VALUES, file);
+    fclose(file);
+    heap_sort(values, BENCH_VALUES);
+    printf("%d values, %d MiB file (seconds)\n", BENCH_VALUES,
+            (int) (BENCH_VALUES * sizeof(int) >> 20));
+    size_t budgets[] = {(size_t) 8 << 20, (size_t) 64 << 20, (size_t) 256 << 20};
+
+    for(int b = 0; b < 3; b++) {
+        double start = wall_time();
+        long count = external_sort(input, output, budgets[b], directory);
+        double seconds = wall_time() - start;
+        file = fopen(output, "rb");
+        int read = file == NULL ? 0 :
+                (int) fread(sorted, sizeof *sorted, BENCH_VALUES, file);
+
+        if (file != NULL) {
+            fclose(file);
+        }
+        printf("budget %3d MiB  %7.3f  sorted: %ld  same as heap_sort: %d\n",
+                (int) (budgets[b] >> 20), seconds, count,
+                read == BENCH_VALUES
+                        && memcmp(sorted, values, BENCH_VALUES * sizeof *values) == 0);
+    }
+    // An input that fits in one run is sorted straight to output, which
+    // here cannot be opened.
+    file = fopen(input, "wb");
+    fwrite(values, sizeof *values, 3, file);
+    fclose(file);
+    printf("unopenable output: %ld\n",
+            external_sort(input, "/nonexistent/output.bin", 0, directory));
+    remove(output);
+    remove(input);
+    free(sorted);
+    free(values);
+}
+
 /**
  * @param argc - unused
  * @param argv - unused
@@ -82,6 +676,15 @@ int main(int argc, char *argv[]) {
     setbuf(stdout, NULL);
 
     test_heap();
+    test_heap_grow();
+    test_priority_queue();
+    test_heap_indexed();
+    bench_heapify();
+    bench_remove();
+    bench_dijkstra();
+    bench_sort();
+    bench_merge();
+    test_external_sort();
 
     return (EXIT_SUCCESS);
 }
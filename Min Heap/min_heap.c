@@ -13,66 +13,139 @@
 #include <string.h>
 
 #include "min_heap.h"
+#include "sort.h"
 
 #define STRING_SIZE 80
 
 // local functions
 
 /**
- * Swaps two data values.
+ * Returns the index of the smallest of count values from first on. The
+ * index is picked with conditional moves rather than branches, which the
+ * processor could not predict.
  *
- * @param a pointer to data.
- * @param b pointer to data.
+ * @param values - array of values
+ * @param first - index of the first value
+ * @param count - number of values, 1 to HEAP_ARITY
+ * @return - index of the smallest value
  */
-static void heap_swap(int *a, int *b) {
-	int temp = *a;
-	*a = *b;
-	*b = temp;
-	return;
+static inline int heap_min_child(const int *values, int first, int count) {
+	int min = first;
+	int min_value = values[first];
+
+	if (count == HEAP_ARITY) {
+		// A full group: a fixed trip count the compiler unrolls.
+		for (int c = first + 1; c < first + HEAP_ARITY; c++) {
+			int smaller = values[c] < min_value;
+			min = smaller ? c : min;
+			min_value = smaller ? values[c] : min_value;
+		}
+	} else {
+		for (int c = first + 1; c < first + count; c++) {
+			int smaller = values[c] < min_value;
+			min = smaller ? c : min;
+			min_value = smaller ? values[c] : min_value;
+		}
+	}
+	return min;
 }
 
 /**
  * Moves the last value in source until it is in its correct location
- * in source.
+ * in source. Parents are moved down into the hole left by the value,
+ * which is written once at the end.
  *
  * @param source - pointer to a heap
  */
 static void heapify_up(min_heap *source) {
+	int *values = source->values;
 	int i = source->count - 1;
-	int val = source->values[i];
-	while (i > 0) {
-		int pi = (i - 1) >> 1;
-		if (source->values[pi] <= val) {
-			break;
-		} else {
-			heap_swap(&source->values[i], &source->values[pi]);
-			i = pi;
-		}
+	int val = values[i];
+
+	while (i > 0 && values[HEAP_PARENT(i)] > val) {
+		values[i] = values[HEAP_PARENT(i)];
+		i = HEAP_PARENT(i);
 	}
+	values[i] = val;
 	return;
 }
 
 /**
- * Moves a value down source to its correct position.
+ * Moves a value down source to its correct position. The smallest child
+ * is moved up into the hole left by the value, which is written once at
+ * the end.
  *
  * @param source - pointer to a heap
+ * @param i - index of the value to move
  */
-static void heapify_down(min_heap *source) {
-	int i = 0;
-	int val = source->values[i];
-	int ci = (i << 1) + 1;
+static void heapify_down(min_heap *source, int i) {
+	int *values = source->values;
+	int val = values[i];
 	int n = source->count;
-	while (ci <= n) {
-		if ((ci < n) && (source->values[ci] > source->values[ci + 1])) {
-			ci++;
-		}
-		if (source->values[ci] >= val) {
+	int ci = HEAP_CHILD(i);
+
+	while (ci < n) {
+		int left = n - ci;
+		ci = heap_min_child(values, ci, left < HEAP_ARITY ? left : HEAP_ARITY);
+
+		if (values[ci] >= val) {
 			break;
-		} else {
-			heap_swap(&source->values[i], &source->values[ci]);
-			i = ci;
-			ci = (i << 1) + 1;
 		}
+		values[i] = values[ci];
+		i = ci;
+		ci = HEAP_CHILD(i);
+	}
+	values[i] = val;
+	return;
+}
+
+/**
+ * Allocates room for capacity values, placed so that every group of
+ * siblings, which starts at index 1 + HEAP_ARITY * k, lies in one cache
+ * line.
+ *
+ * @param block - set to the allocation, which is what gets freed
+ * @param capacity - number of values
+ * @return - pointer to the first value
+ */
+static int* heap_allocate(int **block, int capacity) {
+	size_t size = (capacity + HEAP_ARITY) * sizeof **block;
+	// aligned_alloc requires a multiple of the alignment.
+	size = (size + HEAP_ALIGN - 1) / HEAP_ALIGN * HEAP_ALIGN;
+	*block = aligned_alloc(HEAP_ALIGN, size);
+	return *block + HEAP_ARITY - 1;
+}
+
+/**
+ * Reallocates the values of source to hold capacity values.
+ *
+ * @param source - pointer to a heap
+ * @param capacity - new capacity, at least count
+ */
+static void heap_resize(min_heap *source, int capacity) {
+	int *block = NULL;
+	int *values = heap_allocate(&block, capacity);
+	memcpy(values, source->values, source->count * sizeof *values);
+	free(source->block);
+	source->block = block;
+	source->values = values;
+	source->capacity = capacity;
+	return;
+}
+
+/**
+ * Makes sure source can hold at least capacity values, at least doubling
+ * its capacity when it grows so that growth costs O(1) per value.
+ *
+ * @param source - pointer to a heap
+ * @param capacity - number of values needed
+ */
+static void heap_grow(min_heap *source, int capacity) {
+
+	if (capacity > source->capacity) {
+		int doubled = source->capacity < HEAP_INIT ?
+				HEAP_INIT : source->capacity * 2;
+		heap_resize(source, capacity > doubled ? capacity : doubled);
 	}
 	return;
 }
@@ -81,25 +154,47 @@ static void heapify_down(min_heap *source) {
 
 min_heap* min_heap_initialize(int capacity) {
 	min_heap *source = malloc(sizeof *source);
-	source->values = malloc(capacity * sizeof *source->values);
+	source->values = heap_allocate(&source->block, capacity);
 	source->capacity = capacity;
+	source->reserved = capacity;
 	source->count = 0;
 	return source;
 }
 
+void min_heap_reserve(min_heap *source, int capacity) {
+
+	if (capacity > source->capacity) {
+		heap_resize(source, capacity);
+	}
+	if (capacity > source->reserved) {
+		source->reserved = capacity;
+	}
+	return;
+}
+
 void min_heap_free(min_heap **source) {
-	free((*source)->values);
-	free(*source);
+	free((*source)->block);
+	(*source)->block = NULL;
 	(*source)->values = NULL;
 	(*source)->count = 0;
 	(*source)->capacity = 0;
+	free(*source);
 	*source = NULL;
 	return;
 }
 
 void min_heap_heapify(min_heap *source, int *keys, int count) {
-	for (int i = 0; i < count; i++) {
-		min_heap_insert(source, keys[i]);
+	heap_grow(source, source->count + count);
+	memcpy(source->values + source->count, keys, count * sizeof *keys);
+	source->count += count;
+
+	// Floyd's construction: sift down every parent, from the last one up.
+	// Most values are near the leaves and move only a level or two, so
+	// this takes O(n) rather than the O(n log n) of one insert per value.
+	int last = source->count - 1;
+
+	for (int i = last > 0 ? HEAP_PARENT(last) : -1; i >= 0; i--) {
+		heapify_down(source, i);
 	}
 	return;
 }
@@ -109,7 +204,7 @@ int min_heap_empty(const min_heap *source) {
 }
 
 int min_heap_full(const min_heap *source) {
-	return (source->count == source->capacity);
+	return 0;
 }
 
 int min_heap_count(const min_heap *source) {
@@ -117,6 +212,10 @@ int min_heap_count(const min_heap *source) {
 }
 
 void min_heap_insert(min_heap *source, const int value) {
+	// The only branch added to insert, and rarely taken.
+	if (source->count == source->capacity) {
+		heap_grow(source, source->count + 1);
+	}
 	// Add new value to end of the heap.
 	source->values[source->count] = value;
 	source->count++;
@@ -137,7 +236,14 @@ int min_heap_remove(min_heap *source) {
 		// Move last value to top of heap.
 		source->values[0] = source->values[source->count];
 		// Fix the heap.
-		heapify_down(source);
+		heapify_down(source, 0);
+	}
+	// Wait until count falls well below half of capacity before halving it,
+	// so that alternating inserts and removes do not resize every time.
+	if (HEAP_SHRINK > 0 && source->count <= source->capacity / HEAP_SHRINK
+			&& source->capacity > HEAP_INIT
+			&& source->capacity / 2 >= source->reserved) {
+		heap_resize(source, source->capacity / 2);
 	}
 	return value;
 }
@@ -150,16 +256,10 @@ int min_heap_remove(min_heap *source) {
  * @return - 1 if heap is valid, 0 otherwise
  */
 int min_heap_valid(const min_heap *source) {
-	int i = 0;
+	int i = 1;
 	int valid = 1;
-	while (i <= (source->count - 1) / 2) {
-		if (i * 2 + 1 <= source->count - 1
-				&& source->values[i] > source->values[i * 2 + 1]) {
-			valid = 0;
-		} else if (i * 2 + 2 <= source->count - 1
-				&& source->values[i] > source->values[i * 2 + 2]) {
-			valid = 0;
-		}
+	while (valid && i < source->count) {
+		valid = (source->values[HEAP_PARENT(i)] <= source->values[i]);
 		i++;
 	}
 	return valid;
@@ -168,22 +268,33 @@ int min_heap_valid(const min_heap *source) {
 int min_heap_replace(min_heap *source, int replacement) {
 	int value = source->values[0];
 	source->values[0] = replacement;
-	heapify_down(source);
+	heapify_down(source, 0);
 	return value;
 }
 
-int compare(const void *a, const void *b) {
-	return (*(int*) a - *(int*) b);
-}
-
 /**
- * Sorts an array of integers.
+ * Sorts an array of integers, by heapsort, radix sort or parallel sample
+ * sort depending on its size and the number of CPUs.
  *
  * @param values - array of values to sort
  * @param count - number of values in values
  */
 void heap_sort(int *values, int count) {
-	qsort(values, count, sizeof(int), compare);
+
+	if (count < SORT_RADIX_MIN) {
+		sort_heap(values, count);
+	} else if (count < SORT_PARALLEL_MIN) {
+		sort_radix(values, count);
+	} else {
+		// With one CPU the threads would only take turns.
+		int threads = sort_threads();
+
+		if (threads < 2) {
+			sort_radix(values, count);
+		} else {
+			sort_sample(values, count, threads);
+		}
+	}
 	return;
 }
 
@@ -17,23 +17,49 @@
 #include <string.h>
 
 #define HEAP_INIT 15 // Defines four full rows of heap
+// Number of children per node: 2, 4, 8 or 16. Wider nodes make the heap
+// shallower and put all the children a sift-down compares in one cache
+// line, at the cost of more comparisons per level.
+#ifndef HEAP_ARITY
+#define HEAP_ARITY 8
+#endif
+#define HEAP_ALIGN 64 // Cache line size
+// Index of the first child of i, and of the parent of i.
+#define HEAP_CHILD(i) (HEAP_ARITY * (i) + 1)
+#define HEAP_PARENT(i) (((i) - 1) / HEAP_ARITY)
+// A remove that leaves count at 1 / HEAP_SHRINK of capacity halves the
+// capacity, down to the reserved capacity. 0 never shrinks.
+#define HEAP_SHRINK 4
 
 /**
  * Heap header.
  */
 typedef struct {
     int capacity;     // current capacity of the heap
+    int reserved;     // capacity the heap never shrinks below
     int count;         // count of number of values in the heap
     int *values; // pointer to array of data values.
+    int *block;  // allocation holding values, aligned to HEAP_ALIGN
 } min_heap;
 
 // Prototypes
 
 /**
- * Initialize a heap structure
- * @return
+ * Initialize a heap structure. The heap grows as values are added.
+ *
+ * @param capacity - initial capacity, also reserved
+ * @return - pointer to a heap
+ */
+min_heap* min_heap_initialize(int capacity);
+
+/**
+ * Makes sure a heap can hold capacity values without growing, and keeps
+ * it from shrinking below that.
+ *
+ * @param source - pointer to a heap
+ * @param capacity - number of values to make room for
  */
-min_heap* min_heap_initialize();
+void min_heap_reserve(min_heap *source, int capacity);
 
 /**
  * Frees heap memory.
@@ -43,8 +69,8 @@ min_heap* min_heap_initialize();
 void min_heap_free(min_heap **source);
 
 /**
- * Create a heap from an array of values. Heap capacity must be
- * large enough to hold all values in array.
+ * Adds an array of values to a heap in O(n), growing the heap if its
+ * capacity is too small.
  *
  * @param source - pointer to a heap
  * @param values - array of values to insert into heap
@@ -68,10 +94,10 @@ void min_heap_free(min_heap **source);
 int min_heap_empty(const min_heap *source);
 
 /**
- * Determines if source is full, i.e. count == capacity
+ * Determines if source is full. A heap grows as needed, so is never full.
  *
  * @param source - pointer to a heap
- * @return - 1 if source is full, 0 otherwise.
+ * @return - 0
  */
 int min_heap_full(const min_heap *source);
 
@@ -84,7 +110,8 @@ int min_heap_full(const min_heap *source);
 int min_heap_count(const min_heap *source);
 
 /**
- * Adds a value to source.
+ * Adds a value to source, doubling its capacity if it is full:
+ * amortized O(log n).
  *
  * @param source - pointer to a heap
  * @param value - the value to add to source
@@ -135,7 +162,9 @@ int min_heap_valid(const min_heap *source);
 int min_heap_replace(min_heap *source, int replacement);
 
 /**
- * Sorts an array of integers.
+ * Sorts an array of integers: in-place heapsort below SORT_RADIX_MIN
+ * values, radix sort below SORT_PARALLEL_MIN, and parallel sample sort
+ * above (see sort.h).
  *
  * @param values - array of values to sort
  * @param count - number of values in values
@@ -0,0 +1,198 @@
+/**
+ * -------------------------------------
+ * @file  min_heap_indexed.c
+ * Indexed Minimum Heap Source Code File
+ * -------------------------------------
+ * @author Filip Stanojcic
+ *
+ * @version 2026-10-18
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "min_heap_indexed.h"
+
+// local functions
+
+/**
+ * Puts a key and its id into slot i and records the slot in the position
+ * map.
+ *
+ * @param source - pointer to an indexed heap
+ * @param i - heap slot
+ * @param key - the key
+ * @param id - the id of key
+ */
+static inline void heap_place(min_heap_indexed *source, int i, int key,
+		int id) {
+	source->keys[i] = key;
+	source->slots[i] = id;
+	source->positions[id] = i;
+	return;
+}
+
+/**
+ * Moves the key in slot i up to its correct position, moving parents down
+ * into the hole it leaves.
+ *
+ * @param source - pointer to an indexed heap
+ * @param i - heap slot of the key to move
+ */
+static void heapify_up(min_heap_indexed *source, int i) {
+	int key = source->keys[i];
+	int id = source->slots[i];
+
+	while (i > 0 && source->keys[HEAP_PARENT(i)] > key) {
+		int pi = HEAP_PARENT(i);
+		heap_place(source, i, source->keys[pi], source->slots[pi]);
+		i = pi;
+	}
+	heap_place(source, i, key, id);
+	return;
+}
+
+/**
+ * Moves the key in slot i down to its correct position, moving the
+ * smallest child up into the hole it leaves.
+ *
+ * @param source - pointer to an indexed heap
+ * @param i - heap slot of the key to move
+ */
+static void heapify_down(min_heap_indexed *source, int i) {
+	int key = source->keys[i];
+	int id = source->slots[i];
+	int n = source->count;
+	int ci = HEAP_CHILD(i);
+
+	while (ci < n) {
+		int last = ci + HEAP_ARITY < n ? ci + HEAP_ARITY : n;
+		int min = ci;
+
+		for (int c = ci + 1; c < last; c++) {
+			min = source->keys[c] < source->keys[min] ? c : min;
+		}
+		if (source->keys[min] >= key) {
+			break;
+		}
+		heap_place(source, i, source->keys[min], source->slots[min]);
+		i = min;
+		ci = HEAP_CHILD(i);
+	}
+	heap_place(source, i, key, id);
+	return;
+}
+
+// Public indexed minimum heap functions
+
+min_heap_indexed* min_heap_indexed_initialize(int ids) {
+	min_heap_indexed *source = malloc(sizeof *source);
+	source->ids = ids;
+	source->count = 0;
+	source->keys = malloc(ids * sizeof *source->keys);
+	source->slots = malloc(ids * sizeof *source->slots);
+	source->positions = malloc(ids * sizeof *source->positions);
+
+	for (int id = 0; id < ids; id++) {
+		source->positions[id] = -1;
+	}
+	return source;
+}
+
+void min_heap_indexed_free(min_heap_indexed **source) {
+	free((*source)->keys);
+	free((*source)->slots);
+	free((*source)->positions);
+	free(*source);
+	*source = NULL;
+	return;
+}
+
+int min_heap_indexed_empty(const min_heap_indexed *source) {
+	return (source->count == 0);
+}
+
+int min_heap_indexed_count(const min_heap_indexed *source) {
+	return (source->count);
+}
+
+int min_heap_indexed_contains(const min_heap_indexed *source, int id) {
+	return (source->positions[id] >= 0);
+}
+
+int min_heap_indexed_key(const min_heap_indexed *source, int id) {
+	return (source->keys[source->positions[id]]);
+}
+
+void min_heap_indexed_insert(min_heap_indexed *source, int id, int key) {
+	// Add the new key to the end of the heap, then fix the heap.
+	heap_place(source, source->count, key, id);
+	source->count++;
+	heapify_up(source, source->count - 1);
+	return;
+}
+
+int min_heap_indexed_peek(const min_heap_indexed *source, int *id) {
+
+	if (id != NULL) {
+		*id = source->slots[0];
+	}
+	return (source->keys[0]);
+}
+
+int min_heap_indexed_remove(min_heap_indexed *source, int *id) {
+
+	if (id != NULL) {
+		*id = source->slots[0];
+	}
+	return min_heap_indexed_delete(source, source->slots[0]);
+}
+
+void min_heap_indexed_decrease_key(min_heap_indexed *source, int id, int key) {
+	int i = source->positions[id];
+	source->keys[i] = key;
+	heapify_up(source, i);
+	return;
+}
+
+void min_heap_indexed_increase_key(min_heap_indexed *source, int id, int key) {
+	int i = source->positions[id];
+	source->keys[i] = key;
+	heapify_down(source, i);
+	return;
+}
+
+int min_heap_indexed_delete(min_heap_indexed *source, int id) {
+	int i = source->positions[id];
+	int key = source->keys[i];
+	source->positions[id] = -1;
+	source->count--;
+
+	if (i < source->count) {
+		// Move the last key into the hole, then fix the heap: it may have
+		// to go either way when the hole is not at the root.
+		int last = source->count;
+		heap_place(source, i, source->keys[last], source->slots[last]);
+
+		if (i > 0 && source->keys[HEAP_PARENT(i)] > source->keys[i]) {
+			heapify_up(source, i);
+		} else {
+			heapify_down(source, i);
+		}
+	}
+	return key;
+}
+
+int min_heap_indexed_valid(const min_heap_indexed *source) {
+	int valid = 1;
+	int placed = 0;
+
+	for (int i = 0; valid && i < source->count; i++) {
+		valid = source->positions[source->slots[i]] == i
+				&& (i == 0 || source->keys[HEAP_PARENT(i)] <= source->keys[i]);
+	}
+	for (int id = 0; valid && id < source->ids; id++) {
+		placed += (source->positions[id] >= 0);
+	}
+	return valid && placed == source->count;
+}
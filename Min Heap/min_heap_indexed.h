@@ -0,0 +1,152 @@
+/**
+ * -------------------------------------
+ * @file  min_heap_indexed.h
+ * Indexed Minimum Heap Header File
+ * -------------------------------------
+ * @author Filip Stanojcic
+ *
+ * @version 2026-10-18
+ *
+ * A min_heap of keys, each belonging to an id from 0 to ids - 1, such as a
+ * vertex of a graph. A position map from id to heap slot, kept up to date
+ * as keys move, finds any id's key in O(1), so it can be changed or
+ * deleted in O(log n) without searching the heap. Each id is in the heap
+ * at most once.
+ */
+#ifndef MIN_HEAP_INDEXED_H_
+#define MIN_HEAP_INDEXED_H_
+
+// Includes
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "min_heap.h"
+
+/**
+ * Indexed heap header.
+ */
+typedef struct {
+    int ids;          // number of ids: ids are 0 to ids - 1
+    int count;        // count of number of keys in the heap
+    int *keys;        // keys in heap order
+    int *slots;       // id of the key in each heap slot
+    int *positions;   // heap slot of each id, -1 if the id is not in the heap
+} min_heap_indexed;
+
+// Prototypes
+
+/**
+ * Initialize an indexed heap.
+ *
+ * @param ids - number of ids
+ * @return - pointer to an indexed heap
+ */
+min_heap_indexed* min_heap_indexed_initialize(int ids);
+
+/**
+ * Frees indexed heap memory.
+ *
+ * @param source - pointer to an indexed heap
+ */
+void min_heap_indexed_free(min_heap_indexed **source);
+
+/**
+ * Determines if source is empty.
+ *
+ * @param source - pointer to an indexed heap
+ * @return - 1 if source is empty, 0 otherwise.
+ */
+int min_heap_indexed_empty(const min_heap_indexed *source);
+
+/**
+ * Returns the number of keys in source.
+ *
+ * @param source - pointer to an indexed heap
+ * @return - number of keys in source
+ */
+int min_heap_indexed_count(const min_heap_indexed *source);
+
+/**
+ * Determines if id has a key in source, in O(1).
+ *
+ * @param source - pointer to an indexed heap
+ * @param id - id to look for
+ * @return - 1 if id is in source, 0 otherwise.
+ */
+int min_heap_indexed_contains(const min_heap_indexed *source, int id);
+
+/**
+ * Returns the key of id, which must be in source.
+ *
+ * @param source - pointer to an indexed heap
+ * @param id - id in source
+ * @return - the key of id
+ */
+int min_heap_indexed_key(const min_heap_indexed *source, int id);
+
+/**
+ * Adds id with a key to source. id must not be in source.
+ *
+ * @param source - pointer to an indexed heap
+ * @param id - id to add
+ * @param key - its key
+ */
+void min_heap_indexed_insert(min_heap_indexed *source, int id, int key);
+
+/**
+ * Returns the smallest key in source, source is unchanged. source must not
+ * be empty.
+ *
+ * @param source - pointer to an indexed heap
+ * @param id - set to the id of the key, if not NULL
+ * @return - the smallest key
+ */
+int min_heap_indexed_peek(const min_heap_indexed *source, int *id);
+
+/**
+ * Removes and returns the smallest key in source. source must not be
+ * empty.
+ *
+ * @param source - pointer to an indexed heap
+ * @param id - set to the id of the key, if not NULL
+ * @return - the smallest key
+ */
+int min_heap_indexed_remove(min_heap_indexed *source, int *id);
+
+/**
+ * Lowers the key of id, which must be in source, in O(log n).
+ *
+ * @param source - pointer to an indexed heap
+ * @param id - id in source
+ * @param key - new key, no larger than the current one
+ */
+void min_heap_indexed_decrease_key(min_heap_indexed *source, int id, int key);
+
+/**
+ * Raises the key of id, which must be in source, in O(log n).
+ *
+ * @param source - pointer to an indexed heap
+ * @param id - id in source
+ * @param key - new key, no smaller than the current one
+ */
+void min_heap_indexed_increase_key(min_heap_indexed *source, int id, int key);
+
+/**
+ * Removes id, which must be in source, in O(log n).
+ *
+ * @param source - pointer to an indexed heap
+ * @param id - id in source
+ * @return - the key of id
+ */
+int min_heap_indexed_delete(min_heap_indexed *source, int id);
+
+/**
+ * Determines if an indexed heap is valid: all keys are >= parent keys, and
+ * the position map matches the heap.
+ *
+ * @param source - pointer to an indexed heap
+ * @return - 1 if source is valid, 0 otherwise
+ */
+int min_heap_indexed_valid(const min_heap_indexed *source);
+
+#endif /* MIN_HEAP_INDEXED_H_ */
@@ -0,0 +1,278 @@
+/**
+ * -------------------------------------
+ * @file  priority_queue.c
+ * Priority Queue Source Code File
+ * -------------------------------------
+ * @author Filip Stanojcic
+ *
+ * @version 2026-10-18
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "priority_queue.h"
+
+// TRUE if key a comes out before key b.
+#ifdef PQ_MAX
+#define PQ_COMPARE(a, b) ((a) > (b))
+#else
+#define PQ_COMPARE(a, b) ((a) < (b))
+#endif
+// Index of the first child of i, and of the parent of i.
+#define PQ_CHILD(i) (PQ_ARITY * (i) + 1)
+#define PQ_PARENT(i) (((i) - 1) / PQ_ARITY)
+
+// local functions
+
+/**
+ * Returns the index of the first of count keys from first on, picked
+ * with conditional moves rather than branches.
+ *
+ * @param keys - array of keys
+ * @param first - index of the first key
+ * @param count - number of keys, 1 to PQ_ARITY
+ * @return - index of the key that comes out first
+ */
+static inline int pq_min_child(const pq_key *keys, int first, int count) {
+	int min = first;
+	pq_key min_key = keys[first];
+
+	if (count == PQ_ARITY) {
+		// A full group: a fixed trip count the compiler unrolls.
+		for (int c = first + 1; c < first + PQ_ARITY; c++) {
+			int before = PQ_COMPARE(keys[c], min_key);
+			min = before ? c : min;
+			min_key = before ? keys[c] : min_key;
+		}
+	} else {
+		for (int c = first + 1; c < first + count; c++) {
+			int before = PQ_COMPARE(keys[c], min_key);
+			min = before ? c : min;
+			min_key = before ? keys[c] : min_key;
+		}
+	}
+	return min;
+}
+
+/**
+ * Moves a pair up from index i into its correct position, moving parents
+ * down into the hole it leaves.
+ *
+ * @param source - pointer to a priority queue
+ * @param i - index to place the pair from
+ * @param key - the key to place
+ * @param payload - its payload
+ */
+static void pq_sift_up(priority_queue *source, int i, pq_key key,
+		pq_payload payload) {
+	pq_key *keys = source->keys;
+	pq_payload *payloads = source->payloads;
+
+	while (i > 0 && PQ_COMPARE(key, keys[PQ_PARENT(i)])) {
+		keys[i] = keys[PQ_PARENT(i)];
+		payloads[i] = payloads[PQ_PARENT(i)];
+		i = PQ_PARENT(i);
+	}
+	keys[i] = key;
+	payloads[i] = payload;
+	return;
+}
+
+/**
+ * Moves a pair down from index i into its correct position, moving the
+ * first child up into the hole it leaves.
+ *
+ * @param source - pointer to a priority queue
+ * @param i - index to place the pair from
+ * @param key - the key to place
+ * @param payload - its payload
+ */
+static void pq_sift_down(priority_queue *source, int i, pq_key key,
+		pq_payload payload) {
+	pq_key *keys = source->keys;
+	pq_payload *payloads = source->payloads;
+	int n = source->count;
+	int ci = PQ_CHILD(i);
+
+	while (ci < n) {
+		int left = n - ci;
+		ci = pq_min_child(keys, ci, left < PQ_ARITY ? left : PQ_ARITY);
+
+		if (!PQ_COMPARE(keys[ci], key)) {
+			break;
+		}
+		keys[i] = keys[ci];
+		payloads[i] = payloads[ci];
+		i = ci;
+		ci = PQ_CHILD(i);
+	}
+	keys[i] = key;
+	payloads[i] = payload;
+	return;
+}
+
+/**
+ * Reallocates source to hold capacity pairs. Keys are placed so that
+ * every group of siblings, which starts at index 1 + PQ_ARITY * k, lies in
+ * one cache line.
+ *
+ * @param source - pointer to a priority queue
+ * @param capacity - new capacity, at least count
+ */
+static void pq_resize(priority_queue *source, int capacity) {
+	size_t size = (capacity + PQ_ARITY) * sizeof *source->keys;
+	// aligned_alloc requires a multiple of the alignment.
+	size = (size + PQ_ALIGN - 1) / PQ_ALIGN * PQ_ALIGN;
+	pq_key *block = aligned_alloc(PQ_ALIGN, size);
+	pq_key *keys = block + PQ_ARITY - 1;
+
+	if (source->count > 0) {
+		memcpy(keys, source->keys, source->count * sizeof *keys);
+	}
+	free(source->block);
+	source->block = block;
+	source->keys = keys;
+	source->payloads = realloc(source->payloads,
+			(capacity > 0 ? capacity : 1) * sizeof *source->payloads);
+	source->capacity = capacity;
+	return;
+}
+
+/**
+ * Makes sure source can hold at least capacity pairs, at least doubling
+ * its capacity when it grows.
+ *
+ * @param source - pointer to a priority queue
+ * @param capacity - number of pairs needed
+ */
+static void pq_grow(priority_queue *source, int capacity) {
+
+	if (capacity > source->capacity) {
+		int doubled = source->capacity < PQ_INIT ?
+				PQ_INIT : source->capacity * 2;
+		pq_resize(source, capacity > doubled ? capacity : doubled);
+	}
+	return;
+}
+
+// Public priority queue functions
+
+priority_queue* pq_initialize(int capacity) {
+	priority_queue *source = malloc(sizeof *source);
+	source->count = 0;
+	source->keys = NULL;
+	source->payloads = NULL;
+	source->block = NULL;
+	pq_resize(source, capacity);
+	source->reserved = capacity;
+	return source;
+}
+
+void pq_free(priority_queue **source) {
+	free((*source)->block);
+	free((*source)->payloads);
+	free(*source);
+	*source = NULL;
+	return;
+}
+
+void pq_reserve(priority_queue *source, int capacity) {
+
+	if (capacity > source->capacity) {
+		pq_resize(source, capacity);
+	}
+	if (capacity > source->reserved) {
+		source->reserved = capacity;
+	}
+	return;
+}
+
+void pq_heapify(priority_queue *source, const pq_key *keys,
+		const pq_payload *payloads, int count) {
+	pq_grow(source, source->count + count);
+	memcpy(source->keys + source->count, keys, count * sizeof *keys);
+	memcpy(source->payloads + source->count, payloads,
+			count * sizeof *payloads);
+	source->count += count;
+	int last = source->count - 1;
+
+	// Floyd's construction: sift down every parent, from the last one up.
+	for (int i = last > 0 ? PQ_PARENT(last) : -1; i >= 0; i--) {
+		pq_sift_down(source, i, source->keys[i], source->payloads[i]);
+	}
+	return;
+}
+
+int pq_empty(const priority_queue *source) {
+	return (source->count == 0);
+}
+
+int pq_count(const priority_queue *source) {
+	return (source->count);
+}
+
+void pq_insert(priority_queue *source, pq_key key, pq_payload payload) {
+
+	if (source->count == source->capacity) {
+		pq_grow(source, source->count + 1);
+	}
+	source->count++;
+	pq_sift_up(source, source->count - 1, key, payload);
+	return;
+}
+
+pq_key pq_peek(const priority_queue *source, pq_payload *payload) {
+
+	if (payload != NULL) {
+		*payload = source->payloads[0];
+	}
+	return (source->keys[0]);
+}
+
+pq_key pq_remove(priority_queue *source, pq_payload *payload) {
+	pq_key key = pq_peek(source, payload);
+	source->count--;
+
+	if (source->count > 0) {
+		// Sift the last pair down from the root.
+		pq_sift_down(source, 0, source->keys[source->count],
+				source->payloads[source->count]);
+	}
+	if (PQ_SHRINK > 0 && source->count <= source->capacity / PQ_SHRINK
+			&& source->capacity > PQ_INIT
+			&& source->capacity / 2 >= source->reserved) {
+		pq_resize(source, source->capacity / 2);
+	}
+	return key;
+}
+
+pq_key pq_replace(priority_queue *source, pq_key key, pq_payload *payload) {
+	pq_payload replaced = source->payloads[0];
+	pq_key value = source->keys[0];
+	pq_sift_down(source, 0, key, *payload);
+	*payload = replaced;
+	return value;
+}
+
+int pq_valid(const priority_queue *source) {
+	int i = 1;
+	int valid = 1;
+	while (valid && i < source->count) {
+		valid = !PQ_COMPARE(source->keys[i], source->keys[PQ_PARENT(i)]);
+		i++;
+	}
+	return valid;
+}
+
+// for testing
+void pq_print(const priority_queue *source) {
+	printf("{");
+	for (int i = 0; i < source->count; i++) {
+		printf("%" PRId64 ", ", source->keys[i]);
+	}
+	printf("}\n");
+	return;
+}
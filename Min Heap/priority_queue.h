@@ -0,0 +1,166 @@
+/**
+ * -------------------------------------
+ * @file  priority_queue.h
+ * Priority Queue Header File
+ * -------------------------------------
+ * @author Filip Stanojcic
+ *
+ * @version 2026-10-18
+ *
+ * A d-ary heap of (key, payload) pairs. Keys and payloads are kept in
+ * separate arrays, so sifting compares only keys, and a group of
+ * PQ_ARITY sibling keys fills one cache line. Payloads are only moved.
+ *
+ * Keys come out smallest first. Define PQ_MAX for every file (e.g.
+ * -DPQ_MAX) to take them largest first instead: priority_queue.c is
+ * compiled once, so a program has one order. pq_initialize names a
+ * function of the order a file was compiled for, so a file compiled for
+ * the other order fails to link.
+ */
+#ifndef PRIORITY_QUEUE_H_
+#define PRIORITY_QUEUE_H_
+
+// Includes
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#define PQ_ARITY 8   // Children per node: 8 keys fill a cache line
+#define PQ_ALIGN 64  // Cache line size
+#define PQ_INIT 15   // Initial capacity when none is given
+// A remove that leaves count at 1 / PQ_SHRINK of capacity halves the
+// capacity, down to the reserved capacity. 0 never shrinks.
+#define PQ_SHRINK 4
+
+#ifdef PQ_MAX
+#define pq_initialize pq_initialize_max // Links only with a max queue
+#else
+#define pq_initialize pq_initialize_min // Links only with a min queue
+#endif
+
+typedef int64_t pq_key;
+typedef int64_t pq_payload;
+
+/**
+ * Priority queue header.
+ */
+typedef struct {
+    int capacity;         // current capacity of the queue
+    int reserved;         // capacity the queue never shrinks below
+    int count;            // number of pairs in the queue
+    pq_key *keys;         // keys in heap order
+    pq_payload *payloads; // payload of each key, at the same index
+    pq_key *block;        // allocation holding keys, aligned to PQ_ALIGN
+} priority_queue;
+
+// Prototypes
+
+/**
+ * Initialize a priority queue. The queue grows as pairs are added.
+ *
+ * @param capacity - initial capacity, also reserved
+ * @return - pointer to a priority queue
+ */
+priority_queue* pq_initialize(int capacity);
+
+/**
+ * Frees priority queue memory.
+ *
+ * @param source - pointer to a priority queue
+ */
+void pq_free(priority_queue **source);
+
+/**
+ * Makes sure a priority queue can hold capacity pairs without growing,
+ * and keeps it from shrinking below that.
+ *
+ * @param source - pointer to a priority queue
+ * @param capacity - number of pairs to make room for
+ */
+void pq_reserve(priority_queue *source, int capacity);
+
+/**
+ * Adds arrays of keys and payloads to a priority queue in O(n).
+ *
+ * @param source - pointer to a priority queue
+ * @param keys - array of keys
+ * @param payloads - array of payloads, one per key
+ * @param count - number of keys
+ */
+void pq_heapify(priority_queue *source, const pq_key *keys,
+        const pq_payload *payloads, int count);
+
+/**
+ * Determines if source is empty.
+ *
+ * @param source - pointer to a priority queue
+ * @return - 1 if source is empty, 0 otherwise.
+ */
+int pq_empty(const priority_queue *source);
+
+/**
+ * Returns the number of pairs in source.
+ *
+ * @param source - pointer to a priority queue
+ * @return - number of pairs in source
+ */
+int pq_count(const priority_queue *source);
+
+/**
+ * Adds a key and its payload to source.
+ *
+ * @param source - pointer to a priority queue
+ * @param key - the key to add
+ * @param payload - the payload of key
+ */
+void pq_insert(priority_queue *source, pq_key key, pq_payload payload);
+
+/**
+ * Returns the first key in source, source is unchanged. source must not
+ * be empty.
+ *
+ * @param source - pointer to a priority queue
+ * @param payload - set to the payload of the key, if not NULL
+ * @return - the first key
+ */
+pq_key pq_peek(const priority_queue *source, pq_payload *payload);
+
+/**
+ * Removes and returns the first key in source. source must not be empty.
+ *
+ * @param source - pointer to a priority queue
+ * @param payload - set to the payload of the key, if not NULL
+ * @return - the first key
+ */
+pq_key pq_remove(priority_queue *source, pq_payload *payload);
+
+/**
+ * Removes the first key in source and inserts a new pair, with one
+ * sift-down. source count does not change. source must not be empty.
+ *
+ * @param source - pointer to a priority queue
+ * @param key - the key to add
+ * @param payload - the payload of key, set to the payload replaced; must
+ * not be NULL, unlike the payload of pq_peek and pq_remove
+ * @return - the key replaced
+ */
+pq_key pq_replace(priority_queue *source, pq_key key, pq_payload *payload);
+
+/**
+ * Determines if a priority queue is valid: no key comes before its
+ * parent's key.
+ *
+ * @param source - pointer to a priority queue
+ * @return - 1 if source is valid, 0 otherwise
+ */
+int pq_valid(const priority_queue *source);
+
+/**
+ * Prints the keys in source in level order.
+ * (For testing only).
+ *
+ * @param source - pointer to a priority queue
+ */
+void pq_print(const priority_queue *source);
+
+#endif /* PRIORITY_QUEUE_H_ */
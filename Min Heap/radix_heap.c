@@ -0,0 +1,141 @@
+/**
+ * -------------------------------------
+ * @file  radix_heap.c
+ * Radix Heap Source Code File
+ * -------------------------------------
+ * @author Filip Stanojcic
+ *
+ * @version 2026-10-18
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "radix_heap.h"
+
+// local functions
+
+/**
+ * Returns the bucket of a key: 0 if it equals last, otherwise 1 + the
+ * highest bit in which it differs from last.
+ *
+ * @param key - the key
+ * @param last - the last key removed
+ * @return - the bucket of key
+ */
+static inline int radix_bucket_of(unsigned int key, unsigned int last) {
+	unsigned int diff = key ^ last;
+	int bucket = 0;
+
+#if defined(__GNUC__)
+	bucket = diff == 0 ? 0 : 32 - __builtin_clz(diff);
+#else
+	while (diff != 0) {
+		bucket++;
+		diff >>= 1;
+	}
+#endif
+	return bucket;
+}
+
+/**
+ * Adds an item to a bucket, doubling the bucket's capacity if it is full.
+ *
+ * @param bucket - pointer to a bucket
+ * @param key - the key
+ * @param id - the id of key
+ */
+static inline void radix_bucket_push(radix_bucket *bucket, unsigned int key,
+		int id) {
+
+	if (bucket->count == bucket->capacity) {
+		bucket->capacity = bucket->capacity == 0 ? 16 : bucket->capacity * 2;
+		bucket->items = realloc(bucket->items,
+				bucket->capacity * sizeof *bucket->items);
+	}
+	bucket->items[bucket->count].key = key;
+	bucket->items[bucket->count].id = id;
+	bucket->count++;
+	return;
+}
+
+// Public radix heap functions
+
+radix_heap* radix_heap_initialize() {
+	radix_heap *source = malloc(sizeof *source);
+	source->count = 0;
+	source->last = 0;
+
+	for (int b = 0; b < RADIX_BUCKETS; b++) {
+		source->buckets[b].count = 0;
+		source->buckets[b].capacity = 0;
+		source->buckets[b].items = NULL;
+	}
+	return source;
+}
+
+void radix_heap_free(radix_heap **source) {
+
+	for (int b = 0; b < RADIX_BUCKETS; b++) {
+		free((*source)->buckets[b].items);
+	}
+	free(*source);
+	*source = NULL;
+	return;
+}
+
+int radix_heap_empty(const radix_heap *source) {
+	return (source->count == 0);
+}
+
+int radix_heap_count(const radix_heap *source) {
+	return (source->count);
+}
+
+int radix_heap_insert(radix_heap *source, unsigned int key, int id) {
+	int inserted = (key >= source->last);
+
+	if (inserted) {
+		radix_bucket_push(&source->buckets[radix_bucket_of(key, source->last)],
+				key, id);
+		source->count++;
+	}
+	return inserted;
+}
+
+unsigned int radix_heap_remove(radix_heap *source, int *id) {
+	radix_bucket *zero = &source->buckets[0];
+
+	if (zero->count == 0) {
+		// Find the first non-empty bucket and make its smallest key the
+		// new last key. Every other key in it now differs from last in a
+		// lower bit, so it moves to a lower bucket.
+		int b = 1;
+
+		while (source->buckets[b].count == 0) {
+			b++;
+		}
+		radix_bucket *bucket = &source->buckets[b];
+		unsigned int min = bucket->items[0].key;
+
+		for (int i = 1; i < bucket->count; i++) {
+			min = bucket->items[i].key < min ? bucket->items[i].key : min;
+		}
+		source->last = min;
+
+		for (int i = 0; i < bucket->count; i++) {
+			radix_bucket_push(
+					&source->buckets[radix_bucket_of(bucket->items[i].key, min)],
+					bucket->items[i].key, bucket->items[i].id);
+		}
+		bucket->count = 0;
+	}
+	// Every key in bucket 0 equals last.
+	zero->count--;
+	source->count--;
+
+	if (id != NULL) {
+		*id = zero->items[zero->count].id;
+	}
+	return source->last;
+}
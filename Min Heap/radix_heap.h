@@ -0,0 +1,108 @@
+/**
+ * -------------------------------------
+ * @file  radix_heap.h
+ * Radix Heap Header File
+ * -------------------------------------
+ * @author Filip Stanojcic
+ *
+ * @version 2026-10-18
+ *
+ * A monotone priority queue of unsigned keys, each with an int id: no key
+ * inserted may be smaller than the last key removed, as in Dijkstra's
+ * algorithm. Keys are kept in buckets by the highest bit in which they
+ * differ from the last key removed. A remove that empties bucket 0
+ * redistributes the first non-empty bucket, and every key moves to a
+ * lower bucket each time, so insert and remove take O(1) amortized plus
+ * O(log C) for keys up to C apart.
+ */
+#ifndef RADIX_HEAP_H_
+#define RADIX_HEAP_H_
+
+// Includes
+#include <stdio.h>
+#include <stdlib.h>
+
+// Bucket 0 holds keys equal to the last key removed, bucket b > 0 keys
+// whose highest bit that differs from it is bit b - 1.
+#define RADIX_BUCKETS 33
+
+/**
+ * A key and its id.
+ */
+typedef struct {
+    unsigned int key; // the key
+    int id;           // the id of key
+} radix_heap_item;
+
+/**
+ * A bucket of items in no particular order.
+ */
+typedef struct {
+    int count;              // number of items in the bucket
+    int capacity;           // current capacity of items
+    radix_heap_item *items; // the items
+} radix_bucket;
+
+/**
+ * Radix heap header.
+ */
+typedef struct {
+    int count;                            // number of items in the heap
+    unsigned int last;                    // last key removed
+    radix_bucket buckets[RADIX_BUCKETS];  // items by bucket
+} radix_heap;
+
+// Prototypes
+
+/**
+ * Initialize a radix heap.
+ *
+ * @return - pointer to a radix heap
+ */
+radix_heap* radix_heap_initialize();
+
+/**
+ * Frees radix heap memory.
+ *
+ * @param source - pointer to a radix heap
+ */
+void radix_heap_free(radix_heap **source);
+
+/**
+ * Determines if source is empty.
+ *
+ * @param source - pointer to a radix heap
+ * @return - 1 if source is empty, 0 otherwise.
+ */
+int radix_heap_empty(const radix_heap *source);
+
+/**
+ * Returns the number of items in source.
+ *
+ * @param source - pointer to a radix heap
+ * @return - number of items in source
+ */
+int radix_heap_count(const radix_heap *source);
+
+/**
+ * Adds a key and its id to source.
+ *
+ * @param source - pointer to a radix heap
+ * @param key - the key to add, no smaller than the last key removed
+ * @param id - the id of key
+ * @return - 1 if the key was added, 0 if it is smaller than the last key
+ *     removed
+ */
+int radix_heap_insert(radix_heap *source, unsigned int key, int id);
+
+/**
+ * Removes and returns the smallest key in source. source must not be
+ * empty.
+ *
+ * @param source - pointer to a radix heap
+ * @param id - set to the id of the key, if not NULL
+ * @return - the smallest key
+ */
+unsigned int radix_heap_remove(radix_heap *source, int *id);
+
+#endif /* RADIX_HEAP_H_ */
@@ -0,0 +1,364 @@
+/**
+ * -------------------------------------
+ * @file  sort.c
+ * Integer Sorting Source Code File
+ * -------------------------------------
+ * @author Filip Stanojcic
+ *
+ * @version 2026-10-18
+ *
+ */
+#define _POSIX_C_SOURCE 200809L // sysconf
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#include "sort.h"
+
+// Flips the sign bit so that signed keys order as unsigned ones.
+#define SORT_KEY32(v) ((uint32_t) (v) ^ 0x80000000u)
+#define SORT_KEY64(v) ((uint64_t) (v) ^ 0x8000000000000000u)
+
+/**
+ * A sample sort: every thread works on its own chunk of the input in the
+ * first two phases, and on its own range of the output in the last.
+ */
+typedef struct {
+	int *values;          // the values to sort
+	int *buffer;          // buffer of count values
+	int count;            // number of values
+	int threads;          // number of threads and of ranges
+	int splitters[SORT_THREADS]; // first value of each range after the first
+	int starts[SORT_THREADS + 1]; // index of each range in buffer
+	int offsets[SORT_THREADS][SORT_THREADS]; // per thread, next slot of each range
+} sort_job;
+
+/**
+ * The thread index handed to each thread of a phase.
+ */
+typedef struct {
+	sort_job *job; // the sort
+	int index;     // the thread's chunk or range
+} sort_worker;
+
+// local functions
+
+/**
+ * Moves a value down a max-heap of count values to its correct position,
+ * moving the larger child up into the hole it leaves.
+ *
+ * @param values - array of values
+ * @param count - number of values in the heap
+ * @param i - index of the value to move
+ */
+static void sort_sift_down(int *values, int count, int i) {
+	int val = values[i];
+	int ci = 2 * i + 1;
+
+	while (ci < count) {
+		if (ci + 1 < count && values[ci + 1] > values[ci]) {
+			ci++;
+		}
+		if (values[ci] <= val) {
+			break;
+		}
+		values[i] = values[ci];
+		i = ci;
+		ci = 2 * i + 1;
+	}
+	values[i] = val;
+	return;
+}
+
+/**
+ * LSD radix sorts values one byte at a time, using buffer of the same size.
+ * The byte counts for every pass are taken in one read of the values, and
+ * a pass whose byte is the same in every value is skipped. Fewer than two
+ * values are left alone: an empty range of a sample sort must not read
+ * from[0], which belongs to the next range.
+ *
+ * @param values - array of values to sort, left sorted
+ * @param buffer - array of count values
+ * @param count - number of values in values
+ */
+static void sort_radix_aux(int *values, int *buffer, int count) {
+	size_t counts[4][256] = { { 0 } };
+	int *from = values;
+	int *to = buffer;
+
+	if (count > 1) {
+		for (int i = 0; i < count; i++) {
+			uint32_t key = SORT_KEY32(values[i]);
+			counts[0][key & 0xFF]++;
+			counts[1][(key >> 8) & 0xFF]++;
+			counts[2][(key >> 16) & 0xFF]++;
+			counts[3][key >> 24]++;
+		}
+		for (int pass = 0; pass < 4; pass++) {
+			int shift = 8 * pass;
+
+			if (counts[pass][(SORT_KEY32(from[0]) >> shift) & 0xFF]
+					< (size_t) count) {
+				size_t offset = 0;
+
+				for (int d = 0; d < 256; d++) {
+					size_t digits = counts[pass][d];
+					counts[pass][d] = offset;
+					offset += digits;
+				}
+				for (int i = 0; i < count; i++) {
+					to[counts[pass][(SORT_KEY32(from[i]) >> shift) & 0xFF]++] =
+							from[i];
+				}
+				int *temp = from;
+				from = to;
+				to = temp;
+			}
+		}
+		if (from != values) {
+			memcpy(values, from, count * sizeof *values);
+		}
+	}
+	return;
+}
+
+/**
+ * Returns the range of a value: the number of splitters not greater than
+ * it, found without branches.
+ *
+ * @param job - the sample sort
+ * @param value - the value
+ * @return - its range, 0 to threads - 1
+ */
+static inline int sort_range(const sort_job *job, int value) {
+	int range = 0;
+
+	for (int step = SORT_THREADS / 2; step > 0; step /= 2) {
+		int next = range + step;
+		range = (next < job->threads && job->splitters[next] <= value) ?
+				next : range;
+	}
+	return range;
+}
+
+/**
+ * Phase 1: counts the values of a thread's chunk in each range.
+ *
+ * @param arg - pointer to a sort_worker
+ * @return - NULL
+ */
+static void* sort_count(void *arg) {
+	sort_worker *worker = arg;
+	sort_job *job = worker->job;
+	int first = (long) job->count * worker->index / job->threads;
+	int last = (long) job->count * (worker->index + 1) / job->threads;
+	int *counts = job->offsets[worker->index];
+
+	for (int i = first; i < last; i++) {
+		counts[sort_range(job, job->values[i])]++;
+	}
+	return NULL;
+}
+
+/**
+ * Phase 2: copies the values of a thread's chunk to their ranges in the
+ * buffer.
+ *
+ * @param arg - pointer to a sort_worker
+ * @return - NULL
+ */
+static void* sort_scatter(void *arg) {
+	sort_worker *worker = arg;
+	sort_job *job = worker->job;
+	int first = (long) job->count * worker->index / job->threads;
+	int last = (long) job->count * (worker->index + 1) / job->threads;
+	int *offsets = job->offsets[worker->index];
+
+	for (int i = first; i < last; i++) {
+		int value = job->values[i];
+		job->buffer[offsets[sort_range(job, value)]++] = value;
+	}
+	return NULL;
+}
+
+/**
+ * Phase 3: radix sorts a range and copies it back to its place in values,
+ * which it also uses as the radix sort buffer.
+ *
+ * @param arg - pointer to a sort_worker
+ * @return - NULL
+ */
+static void* sort_range_sort(void *arg) {
+	sort_worker *worker = arg;
+	sort_job *job = worker->job;
+	int first = job->starts[worker->index];
+	int count = job->starts[worker->index + 1] - first;
+
+	sort_radix_aux(job->buffer + first, job->values + first, count);
+	memcpy(job->values + first, job->buffer + first,
+			count * sizeof *job->values);
+	return NULL;
+}
+
+/**
+ * Runs one phase of a sample sort on every thread, the caller included,
+ * and waits for them to finish.
+ *
+ * @param job - the sample sort
+ * @param phase - the phase to run
+ */
+static void sort_phase(sort_job *job, void* (*phase)(void*)) {
+	pthread_t threads[SORT_THREADS];
+	sort_worker workers[SORT_THREADS];
+	int started[SORT_THREADS] = { 0 };
+
+	for (int t = 0; t < job->threads; t++) {
+		workers[t].job = job;
+		workers[t].index = t;
+
+		if (t > 0) {
+			started[t] = pthread_create(&threads[t], NULL, phase,
+					&workers[t]) == 0;
+		}
+	}
+	for (int t = 0; t < job->threads; t++) {
+		// The caller runs the first worker, and any that failed to start.
+		if (!started[t]) {
+			phase(&workers[t]);
+		}
+	}
+	for (int t = 1; t < job->threads; t++) {
+		if (started[t]) {
+			pthread_join(threads[t], NULL);
+		}
+	}
+	return;
+}
+
+// Public sorting functions
+
+void sort_heap(int *values, int count) {
+
+	for (int i = count / 2 - 1; i >= 0; i--) {
+		sort_sift_down(values, count, i);
+	}
+	// Move the largest value to the end and shrink the heap around it.
+	for (int n = count - 1; n > 0; n--) {
+		int temp = values[0];
+		values[0] = values[n];
+		values[n] = temp;
+		sort_sift_down(values, n, 0);
+	}
+	return;
+}
+
+void sort_radix(int *values, int count) {
+	int *buffer = malloc(count * sizeof *buffer);
+	sort_radix_aux(values, buffer, count);
+	free(buffer);
+	return;
+}
+
+void sort_radix64(int64_t *values, int count) {
+
+	if (count > 1) {
+		int64_t *buffer = malloc(count * sizeof *buffer);
+		size_t (*counts)[256] = calloc(8, sizeof *counts);
+		int64_t *from = values;
+		int64_t *to = buffer;
+
+		for (int i = 0; i < count; i++) {
+			uint64_t key = SORT_KEY64(values[i]);
+
+			for (int pass = 0; pass < 8; pass++) {
+				counts[pass][(key >> (8 * pass)) & 0xFF]++;
+			}
+		}
+		for (int pass = 0; pass < 8; pass++) {
+			int shift = 8 * pass;
+
+			if (counts[pass][(SORT_KEY64(from[0]) >> shift) & 0xFF]
+					< (size_t) count) {
+				size_t offset = 0;
+
+				for (int d = 0; d < 256; d++) {
+					size_t digits = counts[pass][d];
+					counts[pass][d] = offset;
+					offset += digits;
+				}
+				for (int i = 0; i < count; i++) {
+					to[counts[pass][(SORT_KEY64(from[i]) >> shift) & 0xFF]++] =
+							from[i];
+				}
+				int64_t *temp = from;
+				from = to;
+				to = temp;
+			}
+		}
+		if (from != values) {
+			memcpy(values, from, count * sizeof *values);
+		}
+		free(counts);
+		free(buffer);
+	}
+	return;
+}
+
+int sort_threads(void) {
+	long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+	return cpus < 1 ? 1 : cpus > SORT_THREADS ? SORT_THREADS : (int) cpus;
+}
+
+void sort_sample(int *values, int count, int threads) {
+	// The job's splitters, starts and offsets hold SORT_THREADS ranges.
+	threads = threads > SORT_THREADS ? SORT_THREADS : threads;
+	int samples = threads * SORT_OVERSAMPLE;
+
+	if (threads < 2 || count < samples) {
+		sort_radix(values, count);
+	} else {
+		sort_job *job = calloc(1, sizeof *job);
+		job->values = values;
+		job->buffer = malloc(count * sizeof *job->buffer);
+		job->count = count;
+		job->threads = threads;
+
+		// Sort an evenly spaced sample and take every SORT_OVERSAMPLE-th
+		// value as a splitter.
+		int *sample = malloc(samples * sizeof *sample);
+
+		for (int i = 0; i < samples; i++) {
+			sample[i] = values[(long) count * i / samples];
+		}
+		sort_heap(sample, samples);
+
+		for (int t = 1; t < threads; t++) {
+			job->splitters[t] = sample[t * SORT_OVERSAMPLE];
+		}
+		free(sample);
+		sort_phase(job, sort_count);
+
+		// Each range starts after the ranges before it, and each thread's
+		// share of a range after the shares of the threads before it.
+		int offset = 0;
+
+		for (int r = 0; r < threads; r++) {
+			job->starts[r] = offset;
+
+			for (int t = 0; t < threads; t++) {
+				int counted = job->offsets[t][r];
+				job->offsets[t][r] = offset;
+				offset += counted;
+			}
+		}
+		job->starts[threads] = offset;
+		sort_phase(job, sort_scatter);
+		sort_phase(job, sort_range_sort);
+		free(job->buffer);
+		free(job);
+	}
+	return;
+}
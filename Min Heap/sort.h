@@ -0,0 +1,77 @@
+/**
+ * -------------------------------------
+ * @file  sort.h
+ * Integer Sorting Header File
+ * -------------------------------------
+ * @author Filip Stanojcic
+ *
+ * @version 2026-10-18
+ *
+ * Sorts for arrays of integers, with no comparator function calls:
+ * an in-place heapsort for small arrays, an LSD radix sort that makes one
+ * pass per byte of key that varies, and a sample sort that splits large
+ * arrays into ranges sorted by separate threads. heap_sort picks one by
+ * size, and uses sample sort only on a machine with more than one CPU.
+ */
+#ifndef SORT_H_
+#define SORT_H_
+
+// Includes
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#define SORT_RADIX_MIN 256          // heap_sort uses radix sort from this size
+#define SORT_PARALLEL_MIN (1 << 21) // and sample sort from this size
+#define SORT_THREADS 8              // most threads used by sample sort
+#define SORT_OVERSAMPLE 64          // values sampled per sample sort range
+
+// Prototypes
+
+/**
+ * Sorts an array of integers in place by heapsort: O(n log n), no extra
+ * memory.
+ *
+ * @param values - array of values to sort
+ * @param count - number of values in values
+ */
+void sort_heap(int *values, int count);
+
+/**
+ * Sorts an array of 32-bit integers by LSD radix sort: O(n), with a
+ * buffer of count values.
+ *
+ * @param values - array of values to sort
+ * @param count - number of values in values
+ */
+void sort_radix(int *values, int count);
+
+/**
+ * Sorts an array of 64-bit integers by LSD radix sort: O(n), with a
+ * buffer of count values.
+ *
+ * @param values - array of values to sort
+ * @param count - number of values in values
+ */
+void sort_radix64(int64_t *values, int count);
+
+/**
+ * Sorts an array of integers by sample sort: values are split into ranges
+ * by splitters drawn from a sample, and each range is radix sorted by its
+ * own thread. Uses a buffer of count values.
+ *
+ * @param values - array of values to sort
+ * @param count - number of values in values
+ * @param threads - number of threads, at most SORT_THREADS are used
+ */
+void sort_sample(int *values, int count, int threads);
+
+/**
+ * Returns the number of threads worth giving sample sort: the number of
+ * online CPUs, at most SORT_THREADS.
+ *
+ * @return - number of threads, 1 to SORT_THREADS
+ */
+int sort_threads(void);
+
+#endif /* SORT_H_ */
@@ -9,9 +9,115 @@
 
 #include <stdio.h>
 #include <stdlib.h>
-#include "heap.h"
+#include "../Min Heap/min_heap_indexed.h"
+#include "../Min Heap/radix_heap.h"
+#include "../Min Heap/bucket_queue.h"
 #include "algorithm.h"
 
+/**
+ * The queue behind one run of Dijkstra's algorithm. The heap lowers the key
+ * of a node already in it; the monotone queues cannot, so they hold a node
+ * once per improved label, and the stale copies are skipped when extracted.
+ */
+typedef struct {
+	DIJKSTRA_QUEUE type;
+	min_heap_indexed *heap;
+	radix_heap *radix;
+	bucket_queue *dial;
+} DQUEUE;
+
+/**
+ * Create the queue of the given type for graph g
+ * @param q     - the queue to create
+ * @param type  - the type of queue
+ * @param g     - graph by reference
+ */
+static void dqueue_new(DQUEUE *q, DIJKSTRA_QUEUE type, GRAPH *g) {
+	q->type = type;
+	if (type == DIJKSTRA_HEAP) {
+		q->heap = min_heap_indexed_initialize(g->order);
+	} else if (type == DIJKSTRA_RADIX) {
+		q->radix = radix_heap_initialize();
+	} else {
+		// A label is never more than the largest edge weight above the
+		// last label extracted.
+		int i, span = 0;
+		for (i = 0; i < g->order; i++) {
+			ADJNODE *temp = g->nodes[i]->neighbor;
+			while (temp) {
+				if (temp->weight > span)
+					span = temp->weight;
+				temp = temp->next;
+			}
+		}
+		q->dial = bucket_queue_initialize(span);
+	}
+}
+
+/**
+ * Add node u with label to the queue, or lower its label if it is in it.
+ * The monotone queues reject a label below the last one extracted, which
+ * only a negative edge weight gives, so the program stops rather than
+ * lose the node and return wrong distances.
+ * @param q     - the queue
+ * @param u     - the node
+ * @param label - the label of u
+ */
+static void dqueue_push(DQUEUE *q, int u, int label) {
+	int added = 1;
+	if (q->type == DIJKSTRA_HEAP) {
+		if (min_heap_indexed_contains(q->heap, u)) {
+			min_heap_indexed_decrease_key(q->heap, u, label);
+		} else {
+			min_heap_indexed_insert(q->heap, u, label);
+		}
+	} else if (q->type == DIJKSTRA_RADIX) {
+		added = label >= 0 && radix_heap_insert(q->radix, label, u);
+	} else {
+		added = bucket_queue_insert(q->dial, label, u);
+	}
+	if (!added) {
+		fprintf(stderr, "dijkstra: label %d of node %d rejected by the %s "
+				"queue: negative edge weight?\n", label, u,
+				q->type == DIJKSTRA_RADIX ? "radix" : "Dial");
+		abort();
+	}
+}
+
+/**
+ * Remove the node with the smallest label from the queue
+ * @param q     - the queue
+ * @return      - the node, -1 if the queue is empty
+ */
+static int dqueue_pop(DQUEUE *q) {
+	int u = -1;
+	if (q->type == DIJKSTRA_HEAP) {
+		if (!min_heap_indexed_empty(q->heap))
+			min_heap_indexed_remove(q->heap, &u);
+	} else if (q->type == DIJKSTRA_RADIX) {
+		if (!radix_heap_empty(q->radix))
+			radix_heap_remove(q->radix, &u);
+	} else {
+		if (!bucket_queue_empty(q->dial))
+			bucket_queue_remove(q->dial, &u);
+	}
+	return u;
+}
+
+/**
+ * Free the queue
+ * @param q     - the queue
+ */
+static void dqueue_free(DQUEUE *q) {
+	if (q->type == DIJKSTRA_HEAP) {
+		min_heap_indexed_free(&q->heap);
+	} else if (q->type == DIJKSTRA_RADIX) {
+		radix_heap_free(&q->radix);
+	} else {
+		bucket_queue_free(&q->dial);
+	}
+}
+
 /**
  * Compute and return MST by Prim's algorithm using priority queue (min-heap)
  * @param g     - graph by reference
@@ -22,23 +128,29 @@ EDGELIST* mst_prim(GRAPH *g, int start) {
 	if (g == NULL)
 		return NULL;
 
-	int i, heapindex, n = g->order, T[n], parent[n];
+	int i, n = g->order, T[n], parent[n];
 	for (i = 0; i < n; i++) {
 		T[i] = 0; // T[] represents nodes in the current tree
 		parent[i] = -1; // parent[i] represents the parent of i
 	}
 
-	HEAP *h = new_heap(4); // Heap for finding the minimum weight edge
+	// Heap for finding the minimum weight edge, indexed by node so that a
+	// node's key is found in O(1) rather than by searching the heap.
+	min_heap_indexed *h = min_heap_indexed_initialize(n);
 	T[start] = 1; // Set the first node of the current tree T from start
 
 	// For each neighbor, add the corresponding heap node into the heap
 	ADJNODE *temp = g->nodes[start]->neighbor;
 	while (temp) {
-		HEAPDATA hn;
-		hn.key = temp->weight;
-		hn.value = temp->nid;
-		heap_insert(h, hn);
-		parent[temp->nid] = start;
+		if (T[temp->nid] == 0) {
+			if (!min_heap_indexed_contains(h, temp->nid)) {
+				min_heap_indexed_insert(h, temp->nid, temp->weight);
+				parent[temp->nid] = start;
+			} else if (temp->weight < min_heap_indexed_key(h, temp->nid)) {
+				min_heap_indexed_decrease_key(h, temp->nid, temp->weight);
+				parent[temp->nid] = start;
+			}
+		}
 		temp = temp->next;
 	}
 
@@ -46,33 +158,27 @@ EDGELIST* mst_prim(GRAPH *g, int start) {
 	EDGELIST *mst = new_edgelist();
 
 	// The main loop of Prim's algorithm
-	while (h->size > 0) {
-		HEAPDATA hn = heap_extract_min(h); // Get the minimum node
-		i = hn.value;
+	while (!min_heap_indexed_empty(h)) {
+		int key = min_heap_indexed_remove(h, &i); // Get the minimum node
 		T[i] = 1; // Add i to the current tree
-		insert_edge_end(mst, parent[i], i, hn.key); // Add to MST
+		insert_edge_end(mst, parent[i], i, key); // Add to MST
 
 		// Update the keys of neighbors of the newly added node
 		temp = g->nodes[i]->neighbor;
 		while (temp) {
-			heapindex = heap_search_data(h, temp->nid);
-			if (heapindex >= 0) {
-				if (T[temp->nid] == 0 && temp->weight < h->hda[heapindex].key) {
-					heap_change_key(h, heapindex, temp->weight);
-					parent[temp->nid] = i;
-				}
-			} else {
-				if (T[temp->nid] == 0) {
-					HEAPDATA hn;
-					hn.key = temp->weight;
-					hn.value = temp->nid;
-					heap_insert(h, hn);
+			if (min_heap_indexed_contains(h, temp->nid)) {
+				if (temp->weight < min_heap_indexed_key(h, temp->nid)) {
+					min_heap_indexed_decrease_key(h, temp->nid, temp->weight);
 					parent[temp->nid] = i;
 				}
+			} else if (T[temp->nid] == 0) {
+				min_heap_indexed_insert(h, temp->nid, temp->weight);
+				parent[temp->nid] = i;
 			}
 			temp = temp->next;
 		}
 	}
+	min_heap_indexed_free(&h);
 
 	return mst;
 }
@@ -84,12 +190,26 @@ EDGELIST* mst_prim(GRAPH *g, int start) {
  * @return      - pointer of edge list of shortest path tree
  */
 EDGELIST* spt_dijkstra(GRAPH *g, int start) {
+	return spt_dijkstra_queue(g, start, DIJKSTRA_HEAP);
+}
+
+/**
+ * Compute shortest path tree as edge list by Dijkstra's algorithm using the given priority queue
+ * @param g     - graph by reference
+ * @param start - the root node of shortest path tree
+ * @param queue - the priority queue to use
+ * @return      - pointer of edge list of shortest path tree
+ */
+EDGELIST* spt_dijkstra_queue(GRAPH *g, int start, DIJKSTRA_QUEUE queue) {
 	if (!g)
 		return NULL;
 	EDGELIST *spt = new_edgelist();
-	int i, heapindex, u, n = g->order;
-	int T[n], parent[n], label[n];
-	HEAPDATA hn;
+	int i, u, n = g->order;
+	// On the heap: three stack arrays overflow the stack from about 700k
+	// nodes.
+	int *T = malloc(n * sizeof *T);
+	int *parent = malloc(n * sizeof *parent);
+	int *label = malloc(n * sizeof *label);
 
 	for (i = 0; i < n; i++) {
 		T[i] = 0;
@@ -97,16 +217,13 @@ EDGELIST* spt_dijkstra(GRAPH *g, int start) {
 		parent[i] = -1;
 	}
 
-	HEAP *h = new_heap(4);
+	DQUEUE q;
+	dqueue_new(&q, queue, g);
 	label[start] = 0;
-	hn.key = 0;
-	hn.value = start;
-	heap_insert(h, hn);
-	while (h->size > 0) {
-		hn = heap_extract_min(h);
-		u = hn.value;
+	dqueue_push(&q, start, 0);
+	while ((u = dqueue_pop(&q)) >= 0) {
 		if (T[u])
-			continue;
+			continue; // A stale copy of a node already extracted
 		T[u] = 1;
 		if (parent[u] != -1) {
 			insert_edge_end(spt, parent[u], u, label[u] - label[parent[u]]);
@@ -116,19 +233,15 @@ EDGELIST* spt_dijkstra(GRAPH *g, int start) {
 			if (!T[temp->nid] && label[u] + temp->weight < label[temp->nid]) {
 				label[temp->nid] = label[u] + temp->weight;
 				parent[temp->nid] = u;
-				heapindex = heap_search_data(h, temp->nid);
-				if (heapindex >= 0) {
-					heap_change_key(h, heapindex, label[temp->nid]);
-				} else {
-					HEAPDATA hnNew;
-					hnNew.key = label[temp->nid];
-					hnNew.value = temp->nid;
-					heap_insert(h, hnNew);
-				}
+				dqueue_push(&q, temp->nid, label[temp->nid]);
 			}
 			temp = temp->next;
 		}
 	}
+	dqueue_free(&q);
+	free(label);
+	free(parent);
+	free(T);
 
 	return spt;
 }
@@ -141,12 +254,28 @@ EDGELIST* spt_dijkstra(GRAPH *g, int start) {
  * @return      - pointer of edge list of shortest path
  */
 EDGELIST* sp_dijkstra(GRAPH *g, int start, int end) {
+	return sp_dijkstra_queue(g, start, end, DIJKSTRA_HEAP);
+}
+
+/**
+ * Compute shortest path as edge list by Dijkstra's algorithm using the given priority queue
+ * @param g     - graph by reference
+ * @param start - the start node of shortest path
+ * @param end   - the end node of shortest path
+ * @param queue - the priority queue to use
+ * @return      - pointer of edge list of shortest path
+ */
+EDGELIST* sp_dijkstra_queue(GRAPH *g, int start, int end, DIJKSTRA_QUEUE queue) {
 	if (!g)
 		return NULL;
 
 	EDGELIST *sp = new_edgelist();
-	int i, heapindex, u, n = g->order;
-	int T[n], parent[n], label[n];
+	int i, u, n = g->order;
+	// On the heap: three stack arrays overflow the stack from about 700k
+	// nodes.
+	int *T = malloc(n * sizeof *T);
+	int *parent = malloc(n * sizeof *parent);
+	int *label = malloc(n * sizeof *label);
 
 	for (i = 0; i < n; i++) {
 		T[i] = 0;
@@ -154,39 +283,28 @@ EDGELIST* sp_dijkstra(GRAPH *g, int start, int end) {
 		parent[i] = -1;
 	}
 
-	HEAP *h = new_heap(4);
+	DQUEUE q;
+	dqueue_new(&q, queue, g);
 	label[start] = 0;
-	HEAPDATA hn;
-	hn.key = 0;
-	hn.value = start;
-	heap_insert(h, hn);
-
-	while (h->size > 0) {
-		hn = heap_extract_min(h);
-		u = hn.value;
+	dqueue_push(&q, start, 0);
+
+	while ((u = dqueue_pop(&q)) >= 0) {
 		if (u == end)
 			break;
 		if (T[u])
-			continue;
+			continue; // A stale copy of a node already extracted
 		T[u] = 1;
 		ADJNODE *temp = g->nodes[u]->neighbor;
 		while (temp) {
 			if (!T[temp->nid] && label[u] + temp->weight < label[temp->nid]) {
 				label[temp->nid] = label[u] + temp->weight;
 				parent[temp->nid] = u;
-				heapindex = heap_search_data(h, temp->nid);
-				if (heapindex >= 0) {
-					heap_change_key(h, heapindex, label[temp->nid]);
-				} else {
-					HEAPDATA hnNew;
-					hnNew.key = label[temp->nid];
-					hnNew.value = temp->nid;
-					heap_insert(h, hnNew);
-				}
+				dqueue_push(&q, temp->nid, label[temp->nid]);
 			}
 			temp = temp->next;
 		}
 	}
+	dqueue_free(&q);
 
 	i = end;
 	while (1) {
@@ -195,6 +313,9 @@ EDGELIST* sp_dijkstra(GRAPH *g, int start, int end) {
 		insert_edge_start(sp, parent[i], i, label[i] - label[parent[i]]);
 		i = parent[i];
 	}
+	free(label);
+	free(parent);
+	free(T);
 
 	return sp;
 }
@@ -12,6 +12,17 @@
 #include "edgelist.h"
 #include "graph.h"
 
+/**
+ * Priority queue used by Dijkstra's algorithm. The labels it orders are
+ * non-negative integers that never decrease as nodes are extracted, so
+ * besides the indexed heap, monotone integer queues can be used.
+ */
+typedef enum {
+	DIJKSTRA_HEAP,  // indexed min-heap with decrease-key: O(log n)
+	DIJKSTRA_RADIX, // radix heap: O(1) amortized plus O(log of the label range)
+	DIJKSTRA_DIAL   // Dial's buckets: O(1) plus the largest edge weight per extract
+} DIJKSTRA_QUEUE;
+
 /**
  * Compute and return MST by Prim's algorithm using priority queue (min-heap)
  * @param g     - graph by reference
@@ -28,6 +39,15 @@ EDGELIST* mst_prim(GRAPH *g, int start);
  */
 EDGELIST* spt_dijkstra(GRAPH *g, int start);
 
+/**
+ * Compute shortest path tree as edge list by Dijkstra's algorithm using the given priority queue
+ * @param g     - graph by reference
+ * @param start - the root node of shortest path tree
+ * @param queue - the priority queue to use
+ * @return      - pointer of edge list of shortest path tree
+ */
+EDGELIST* spt_dijkstra_queue(GRAPH *g, int start, DIJKSTRA_QUEUE queue);
+
 /**
  * Compute shortest path as edge list by Dijkstra's algorithm using priority queue (min-heap)
  * @param g     - graph by reference
@@ -37,4 +57,14 @@ EDGELIST* spt_dijkstra(GRAPH *g, int start);
  */
 EDGELIST* sp_dijkstra(GRAPH *g, int start, int end);
 
+/**
+ * Compute shortest path as edge list by Dijkstra's algorithm using the given priority queue
+ * @param g     - graph by reference
+ * @param start - the start node of shortest path
+ * @param end   - the end node of shortest path
+ * @param queue - the priority queue to use
+ * @return      - pointer of edge list of shortest path
+ */
+EDGELIST* sp_dijkstra_queue(GRAPH *g, int start, int end, DIJKSTRA_QUEUE queue);
+
 #endif /* ALGORITHM_H_ */
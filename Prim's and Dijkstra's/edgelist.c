@@ -0,0 +1,78 @@
+/*
+ -------------------------------------
+ File:    edgelist.c
+ -------------------------------------
+ Author:  Filip Stanojcic
+ Version  2026-10-18
+ -------------------------------------
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "edgelist.h"
+
+/**
+ * Create an edge
+ * @param from   - the node the edge leaves
+ * @param to     - the node the edge goes to
+ * @param weight - the weight of the edge
+ * @return       - pointer to the edge, next is NULL
+ */
+static EDGE* new_edge(int from, int to, int weight) {
+	EDGE *e = malloc(sizeof *e);
+	e->from = from;
+	e->to = to;
+	e->weight = weight;
+	e->next = NULL;
+	return e;
+}
+
+EDGELIST* new_edgelist(void) {
+	EDGELIST *g = malloc(sizeof *g);
+	g->size = 0;
+	g->start = NULL;
+	g->end = NULL;
+	return g;
+}
+
+void insert_edge_end(EDGELIST *g, int from, int to, int weight) {
+	EDGE *e = new_edge(from, to, weight);
+	if (g->end) {
+		g->end->next = e;
+	} else {
+		g->start = e;
+	}
+	g->end = e;
+	g->size++;
+}
+
+void insert_edge_start(EDGELIST *g, int from, int to, int weight) {
+	EDGE *e = new_edge(from, to, weight);
+	e->next = g->start;
+	g->start = e;
+	if (!g->end) {
+		g->end = e;
+	}
+	g->size++;
+}
+
+long weight_edgelist(EDGELIST *g) {
+	long weight = 0;
+	EDGE *e = g->start;
+	while (e) {
+		weight += e->weight;
+		e = e->next;
+	}
+	return weight;
+}
+
+void clean_edgelist(EDGELIST **gp) {
+	EDGE *e = (*gp)->start;
+	while (e) {
+		EDGE *next = e->next;
+		free(e);
+		e = next;
+	}
+	free(*gp);
+	*gp = NULL;
+}
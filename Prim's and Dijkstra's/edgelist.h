@@ -0,0 +1,68 @@
+/*
+ -------------------------------------
+ File:    edgelist.h
+ -------------------------------------
+ Author:  Filip Stanojcic
+ Version  2026-10-18
+ -------------------------------------
+ */
+#ifndef EDGELIST_H_
+#define EDGELIST_H_
+
+/**
+ * An edge of an edge list.
+ */
+typedef struct edge {
+	int from;             // the node the edge leaves
+	int to;               // the node the edge goes to
+	int weight;           // weight of the edge
+	struct edge *next;    // next edge in the list
+} EDGE;
+
+/**
+ * A list of edges, such as a tree or path found in a graph.
+ */
+typedef struct edgelist {
+	int size;             // number of edges
+	EDGE *start;          // first edge
+	EDGE *end;            // last edge
+} EDGELIST;
+
+/**
+ * Create an empty edge list
+ * @return      - pointer to the edge list
+ */
+EDGELIST* new_edgelist(void);
+
+/**
+ * Add an edge at the end of an edge list
+ * @param g      - edge list by reference
+ * @param from   - the node the edge leaves
+ * @param to     - the node the edge goes to
+ * @param weight - the weight of the edge
+ */
+void insert_edge_end(EDGELIST *g, int from, int to, int weight);
+
+/**
+ * Add an edge at the start of an edge list
+ * @param g      - edge list by reference
+ * @param from   - the node the edge leaves
+ * @param to     - the node the edge goes to
+ * @param weight - the weight of the edge
+ */
+void insert_edge_start(EDGELIST *g, int from, int to, int weight);
+
+/**
+ * Get the total weight of an edge list
+ * @param g     - edge list by reference
+ * @return      - sum of the weights of its edges
+ */
+long weight_edgelist(EDGELIST *g);
+
+/**
+ * Free an edge list and set its pointer to NULL
+ * @param gp    - pointer to the edge list pointer
+ */
+void clean_edgelist(EDGELIST **gp);
+
+#endif /* EDGELIST_H_ */
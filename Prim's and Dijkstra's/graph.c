@@ -0,0 +1,59 @@
+/*
+ -------------------------------------
+ File:    graph.c
+ -------------------------------------
+ Author:  Filip Stanojcic
+ Version  2026-10-18
+ -------------------------------------
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "graph.h"
+
+GRAPH* new_graph(int n) {
+	GRAPH *g = malloc(sizeof *g);
+	g->order = n;
+	g->size = 0;
+	g->nodes = malloc(n * sizeof *g->nodes);
+	int i;
+	for (i = 0; i < n; i++) {
+		g->nodes[i] = malloc(sizeof *g->nodes[i]);
+		g->nodes[i]->nid = i;
+		g->nodes[i]->neighbor = NULL;
+		g->nodes[i]->last = NULL;
+	}
+	return g;
+}
+
+void add_edge(GRAPH *g, int from, int to, int weight) {
+	ADJNODE *arc = malloc(sizeof *arc);
+	arc->nid = to;
+	arc->weight = weight;
+	arc->next = NULL;
+	GNODE *node = g->nodes[from];
+	if (node->last) {
+		node->last->next = arc;
+	} else {
+		node->neighbor = arc;
+	}
+	node->last = arc;
+	g->size++;
+}
+
+void clean_graph(GRAPH **gp) {
+	GRAPH *g = *gp;
+	int i;
+	for (i = 0; i < g->order; i++) {
+		ADJNODE *temp = g->nodes[i]->neighbor;
+		while (temp) {
+			ADJNODE *next = temp->next;
+			free(temp);
+			temp = next;
+		}
+		free(g->nodes[i]);
+	}
+	free(g->nodes);
+	free(g);
+	*gp = NULL;
+}
@@ -0,0 +1,64 @@
+/*
+ -------------------------------------
+ File:    graph.h
+ -------------------------------------
+ Author:  Filip Stanojcic
+ Version  2026-10-18
+ -------------------------------------
+ */
+#ifndef GRAPH_H_
+#define GRAPH_H_
+
+#define INFINITY 1000000000 // A label larger than any path length
+
+/**
+ * An arc to node nid in an adjacency list.
+ */
+typedef struct adjnode {
+	int nid;              // node the arc goes to
+	int weight;           // weight of the arc
+	struct adjnode *next; // next arc out of the same node
+} ADJNODE;
+
+/**
+ * A node and the arcs out of it.
+ */
+typedef struct gnode {
+	int nid;              // the node's id
+	ADJNODE *neighbor;    // first arc out of the node
+	ADJNODE *last;        // last arc out of the node, to add arcs at the end
+} GNODE;
+
+/**
+ * A weighted graph of nodes 0 to order - 1 in adjacency lists.
+ */
+typedef struct graph {
+	int order;            // number of nodes
+	int size;             // number of arcs
+	GNODE **nodes;        // the nodes, by id
+} GRAPH;
+
+/**
+ * Create a graph of n nodes and no arcs
+ * @param n     - number of nodes
+ * @return      - pointer to the graph
+ */
+GRAPH* new_graph(int n);
+
+/**
+ * Add an arc from one node to another at the end of its adjacency list.
+ * An undirected edge is an arc each way.
+ * @param g      - graph by reference
+ * @param from   - the node the arc leaves
+ * @param to     - the node the arc goes to
+ * @param weight - the weight of the arc
+ */
+void add_edge(GRAPH *g, int from, int to, int weight);
+
+/**
+ * Free a graph and set its pointer to NULL
+ * @param gp    - pointer to the graph pointer
+ */
+void clean_graph(GRAPH **gp);
+
+#endif /* GRAPH_H_ */
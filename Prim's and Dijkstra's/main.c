@@ -0,0 +1,140 @@
+/*
+ -------------------------------------
+ File:    main.c
+ -------------------------------------
+ Author:  Filip Stanojcic
+ Version  2026-10-18
+ -------------------------------------
+ Tests Prim's and Dijkstra's algorithms, and times spt_dijkstra_queue
+ with each queue. Build with the queues it uses:
+   gcc *.c "../Min Heap/min_heap_indexed.c" "../Min Heap/radix_heap.c"
+       "../Min Heap/bucket_queue.c"
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "algorithm.h"
+
+#define BENCH_GRID 1000  // Rows and columns of the benchmark grid graph
+#define BENCH_WEIGHT 100 // Largest edge weight of the grid graph
+
+/**
+ * Print an edge list as from-to:weight pairs and its total weight
+ * @param name  - what the edge list is
+ * @param g     - edge list by reference
+ */
+static void print_edgelist(const char *name, EDGELIST *g) {
+	printf("%-12s", name);
+	EDGE *e = g->start;
+	while (e) {
+		printf(" %d-%d:%d", e->from, e->to, e->weight);
+		e = e->next;
+	}
+	printf("  weight: %ld\n", weight_edgelist(g));
+}
+
+/**
+ * Run each algorithm on a small undirected graph
+ */
+void test_algorithms(void) {
+	int edges[][3] = { { 0, 1, 3 }, { 0, 2, 1 }, { 1, 2, 7 }, { 1, 3, 5 },
+			{ 2, 3, 2 }, { 3, 4, 7 }, { 1, 4, 1 } };
+	const char *names[] = { "heap", "radix", "dial" };
+	GRAPH *g = new_graph(5);
+	int i;
+	for (i = 0; i < 7; i++) {
+		add_edge(g, edges[i][0], edges[i][1], edges[i][2]);
+		add_edge(g, edges[i][1], edges[i][0], edges[i][2]);
+	}
+	EDGELIST *mst = mst_prim(g, 0);
+	print_edgelist("mst", mst);
+	clean_edgelist(&mst);
+
+	for (i = 0; i < 3; i++) {
+		char name[32];
+		EDGELIST *tree = spt_dijkstra_queue(g, 0, (DIJKSTRA_QUEUE) i);
+		snprintf(name, sizeof name, "spt %s", names[i]);
+		print_edgelist(name, tree);
+		clean_edgelist(&tree);
+		EDGELIST *path = sp_dijkstra_queue(g, 0, 4, (DIJKSTRA_QUEUE) i);
+		snprintf(name, sizeof name, "sp 0-4 %s", names[i]);
+		print_edgelist(name, path);
+		clean_edgelist(&path);
+	}
+	clean_graph(&g);
+}
+
+/**
+ * Build a grid of BENCH_GRID x BENCH_GRID nodes, each joined to its four
+ * neighbours by arcs of random weight 1 to BENCH_WEIGHT, with every tenth
+ * row and column a faster highway. It is the grid bench_dijkstra in
+ * "Min Heap/main.c" builds, arc for arc.
+ * @return      - pointer to the graph
+ */
+static GRAPH* bench_grid(void) {
+	int n = BENCH_GRID * BENCH_GRID;
+	unsigned int seed = 11;
+	GRAPH *g = new_graph(n);
+	int u, k;
+	for (u = 0; u < n; u++) {
+		int row = u / BENCH_GRID;
+		int column = u % BENCH_GRID;
+		int neighbours[] = { row > 0 ? u - BENCH_GRID : -1,
+				row < BENCH_GRID - 1 ? u + BENCH_GRID : -1,
+				column > 0 ? u - 1 : -1,
+				column < BENCH_GRID - 1 ? u + 1 : -1 };
+		for (k = 0; k < 4; k++) {
+			if (neighbours[k] >= 0) {
+				seed = seed * 1103515245 + 12345;
+				int weight = 1 + (seed >> 16) % BENCH_WEIGHT;
+				// Roads along a highway row (k >= 2) or column (k < 2).
+				if ((k >= 2 && row % 10 == 0) || (k < 2 && column % 10 == 0)) {
+					weight = 1 + weight / 10;
+				}
+				add_edge(g, u, neighbours[k], weight);
+			}
+		}
+	}
+	return g;
+}
+
+/**
+ * Time spt_dijkstra_queue from node 0 of the grid with each queue
+ */
+void bench_dijkstra(void) {
+	GRAPH *g = bench_grid();
+	const char *names[] = { "indexed heap", "radix heap", "dial buckets" };
+	int *distances = malloc(g->order * sizeof *distances);
+	int i;
+
+	printf("spt_dijkstra_queue on a %dx%d grid (seconds)\n", BENCH_GRID,
+			BENCH_GRID);
+	for (i = 0; i < 3; i++) {
+		clock_t start = clock();
+		EDGELIST *tree = spt_dijkstra_queue(g, 0, (DIJKSTRA_QUEUE) i);
+		double seconds = (double) (clock() - start) / CLOCKS_PER_SEC;
+		// Edges are added as nodes are extracted, so a node's parent
+		// always comes before it.
+		long total = 0;
+		distances[0] = 0;
+		EDGE *e = tree->start;
+		while (e) {
+			distances[e->to] = distances[e->from] + e->weight;
+			total += distances[e->to];
+			e = e->next;
+		}
+		printf("%-12s  %7.3f  sum of distances: %ld\n", names[i], seconds,
+				total);
+		clean_edgelist(&tree);
+	}
+	free(distances);
+	clean_graph(&g);
+}
+
+int main(int argc, char *argv[]) {
+	setbuf(stdout, NULL);
+	test_algorithms();
+	bench_dijkstra();
+	return 0;
+}